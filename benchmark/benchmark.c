@@ -0,0 +1,697 @@
+/*!
+ * \file benchmark.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Benchmark of the arena allocator compared to the standard malloc.
+ * \details For every allocation size distribution (fixed small items,
+ *      power-law sizes and large arrays) each allocator allocates a batch of
+ *      items and then releases all of them, the benchmark reports:
+ *          - the average time of a single allocation
+ *          - the average time to release a single item
+ *          - the peak resident memory of the process during the run
+ *          - the memory used on top of the requested bytes, from the arena
+ *            statistics when available and from the heap otherwise
+ *      Times are measured in nanoseconds on hosted systems and in CPU cycles
+ *      on Cortex-M targets (using the DWT cycle counter).
+ *      On systems with POSIX threads the allocation throughput of the
+ *      concurrent arena is also compared to malloc with an increasing number
+ *      of threads.
+ *      On Linux the time needed to visit many small items in random order is
+ *      measured with regular pages, huge pages and NUMA bound memory.
+ */
+#if defined(__unix__) && !defined(_POSIX_C_SOURCE)
+/*! Needed by the monotonic clock with strict standard modes */
+#define _POSIX_C_SOURCE 200809L
+#endif // __unix__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena-allocator.h"
+#include "arena-allocator-api.h"
+#include "arena-allocator-concurrent-api.h"
+
+#if defined(__unix__)
+#include <pthread.h>
+#include <time.h>
+#endif // __unix__
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define BENCHMARK_HAS_MALLINFO
+#endif // __GLIBC__
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+/*! Number of items allocated by every run, sized for the RAM of a microcontroller */
+#define BENCHMARK_ITEMS (1000U)
+/*! Size of the buffer used by the static arena */
+#define BENCHMARK_STATIC_SIZE (64U * 1024U)
+#else
+/*! Number of items allocated by every run */
+#define BENCHMARK_ITEMS (100000U)
+/*! Size of the buffer used by the static arena */
+#define BENCHMARK_STATIC_SIZE (128U * 1024U * 1024U)
+#endif // __ARM_ARCH_7M__
+/*! Number of runs of every benchmark, the fastest one is reported */
+#define BENCHMARK_RUNS (5U)
+/*! Size of the virtual memory range reserved by the virtual memory arena */
+#define BENCHMARK_VM_SIZE ((size_t)1U << (sizeof(size_t) > 4U ? 36U : 30U))
+/*! Maximum number of threads used by the concurrent benchmark */
+#define BENCHMARK_MAX_THREADS (8U)
+/*! Number of items visited by the scan benchmark */
+#define BENCHMARK_SCAN_ITEMS (4U * 1024U * 1024U)
+
+/*!
+ * \defgroup clock Time measurement
+ * @{
+ */
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+
+#define BENCHMARK_UNIT "cycles"
+#define BENCHMARK_DEMCR (*(volatile uint32_t *)0xE000EDFCU)
+#define BENCHMARK_DWT_CTRL (*(volatile uint32_t *)0xE0001000U)
+#define BENCHMARK_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004U)
+
+/*!
+ * \brief Enable the DWT cycle counter.
+ */
+static void benchmark_clock_init(void) {
+    BENCHMARK_DEMCR |= (1U << 24U);
+    BENCHMARK_DWT_CYCCNT = 0U;
+    BENCHMARK_DWT_CTRL |= 1U;
+}
+
+/*!
+ * \brief Get the current time.
+ *
+ * \return The number of CPU cycles elapsed since the counter was enabled.
+ */
+static uint64_t benchmark_clock_now(void) {
+    return BENCHMARK_DWT_CYCCNT;
+}
+
+#else
+
+#define BENCHMARK_UNIT "ns"
+
+/*!
+ * \brief Initialize the clock, nothing to do on hosted systems.
+ */
+static void benchmark_clock_init(void) {
+}
+
+/*!
+ * \brief Get the current time.
+ *
+ * \return The current value of the monotonic clock in nanoseconds.
+ */
+static uint64_t benchmark_clock_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000U + (uint64_t)now.tv_nsec;
+}
+
+#endif // __ARM_ARCH_7M__
+
+/*! @} */
+
+/*!
+ * \defgroup memory Memory measurement
+ * @{
+ */
+
+/*!
+ * \brief Reset the peak resident memory of the process.
+ */
+static void benchmark_peak_reset(void) {
+#if defined(__linux__)
+    FILE *file = fopen("/proc/self/clear_refs", "w");
+    if (file != NULL) {
+        fputs("5", file);
+        fclose(file);
+    }
+#endif // __linux__
+}
+
+/*!
+ * \brief Get the peak resident memory of the process.
+ *
+ * \return The peak resident memory in KiB or 0 if not available.
+ */
+static size_t benchmark_peak_get(void) {
+    size_t peak = 0U;
+#if defined(__linux__)
+    char line[128];
+    FILE *file = fopen("/proc/self/status", "r");
+    if (file == NULL) {
+        return 0U;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (strncmp(line, "VmHWM:", 6U) == 0) {
+            peak = (size_t)strtoull(line + 6U, NULL, 10);
+            break;
+        }
+    }
+    fclose(file);
+#endif // __linux__
+    return peak;
+}
+
+/*!
+ * \brief Get the amount of heap memory currently in use.
+ *
+ * \return The heap memory in use in bytes or 0 if not available.
+ */
+static size_t benchmark_heap_get(void) {
+#if defined(BENCHMARK_HAS_MALLINFO)
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0U;
+#endif // BENCHMARK_HAS_MALLINFO
+}
+
+/*! @} */
+
+/*!
+ * \defgroup distribution Allocation size distributions
+ * @{
+ */
+
+/*!
+ * \brief Simple xorshift pseudo random number generator.
+ *
+ * \param[in,out] state The state of the generator.
+ * \return The next pseudo random number.
+ */
+static uint32_t benchmark_random(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    *state = x;
+    return x;
+}
+
+/*!
+ * \brief Fixed size small items (e.g. decoded signals).
+ */
+static size_t benchmark_size_small(uint32_t *state) {
+    (void)state;
+    return 16U;
+}
+
+/*!
+ * \brief Power-law distributed sizes between 8 bytes and 8 KiB, smaller items
+ *      are exponentially more frequent.
+ */
+static size_t benchmark_size_power_law(uint32_t *state) {
+    const uint32_t r = benchmark_random(state);
+    /*! Each bit set halves the probability of the next size class */
+    size_t shift = 0U;
+    while (shift < 10U && (r & (1U << shift)) != 0U) {
+        ++shift;
+    }
+    return (size_t)8U << shift;
+}
+
+/*!
+ * \brief Large arrays between 4 KiB and 64 KiB.
+ */
+static size_t benchmark_size_large(uint32_t *state) {
+    return 4096U + (benchmark_random(state) % (60U * 1024U));
+}
+
+/*!
+ * \brief Allocation size distribution.
+ */
+struct BenchmarkDistribution {
+    const char *name;                /*!< The name of the distribution. */
+    size_t (*next)(uint32_t *state); /*!< Function returning the size of the next item. */
+    size_t items;                    /*!< The number of items allocated by every run. */
+};
+
+/*! @} */
+
+/*!
+ * \defgroup allocator Allocators under test
+ * @{
+ */
+
+static void *benchmark_items[BENCHMARK_ITEMS];
+static size_t benchmark_count;
+static struct ArenaAllocatorHandler benchmark_harena;
+static unsigned char *benchmark_buffer;
+
+static void benchmark_malloc_init(void) {
+    benchmark_count = 0U;
+}
+
+static void *benchmark_malloc_alloc(size_t size) {
+    void *item = malloc(size);
+    benchmark_items[benchmark_count++] = item;
+    return item;
+}
+
+static void benchmark_malloc_release(void) {
+    for (size_t i = 0U; i < benchmark_count; ++i) {
+        free(benchmark_items[i]);
+    }
+}
+
+static void benchmark_arena_init(void) {
+    arena_allocator_api_init(&benchmark_harena);
+}
+
+static void benchmark_arena_chunked_init(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED };
+    arena_allocator_api_init_with_config(&benchmark_harena, &config);
+}
+
+static void benchmark_arena_large_block_init(void) {
+    struct ArenaAllocatorConfig config = { .block_size = 1024U * 1024U };
+    arena_allocator_api_init_with_config(&benchmark_harena, &config);
+}
+
+static void benchmark_arena_static_init(void) {
+    arena_allocator_api_init_static(&benchmark_harena, benchmark_buffer, BENCHMARK_STATIC_SIZE);
+}
+
+static void benchmark_arena_vm_init(void) {
+    (void)arena_allocator_api_init_vm(&benchmark_harena, BENCHMARK_VM_SIZE);
+}
+
+static void *benchmark_arena_alloc(size_t size) {
+    return arena_allocator_api_alloc(&benchmark_harena, size);
+}
+
+/*!
+ * \brief Get the memory used by malloc on top of the requested one.
+ *
+ * \param[in]  requested The requested memory in bytes.
+ * \param[in]  heap      The heap memory used in bytes.
+ * \param[out] overhead  The memory used on top of the requested one in bytes.
+ * \return True if the overhead was measured, false if the heap usage is not available.
+ */
+static bool benchmark_malloc_overhead(size_t requested, size_t heap, long long *overhead) {
+#if defined(BENCHMARK_HAS_MALLINFO)
+    *overhead = (long long)heap - (long long)requested;
+    return true;
+#else
+    (void)requested;
+    (void)heap;
+    (void)overhead;
+    return false;
+#endif // BENCHMARK_HAS_MALLINFO
+}
+
+/*!
+ * \brief Get the memory used by the arena on top of the requested one.
+ * \details The blocks and the structure tracking them are taken from the
+ *      arena statistics when the library collects them, otherwise only the
+ *      arenas taking their blocks from the heap can be measured.
+ *
+ * \param[in]  requested The requested memory in bytes.
+ * \param[in]  heap      The heap memory used in bytes.
+ * \param[out] overhead  The memory used on top of the requested one in bytes.
+ * \return True if the overhead was measured, false otherwise.
+ */
+static bool benchmark_arena_overhead(size_t requested, size_t heap, long long *overhead) {
+    struct ArenaAllocatorStats stats;
+    if (arena_allocator_api_get_stats(&benchmark_harena, &stats)) {
+        /*! The overhead of the statistics does not include the unused part of the blocks */
+        *overhead = (long long)(stats.reserved - stats.used + stats.overhead);
+        return true;
+    }
+    if (benchmark_harena.backend != ARENA_ALLOCATOR_BACKEND_HEAP) {
+        return false;
+    }
+    return benchmark_malloc_overhead(requested, heap, overhead);
+}
+
+static void benchmark_arena_release(void) {
+    arena_allocator_api_free(&benchmark_harena);
+}
+
+/*!
+ * \brief Allocator under test.
+ */
+struct BenchmarkAllocator {
+    const char *name;                                                     /*!< The name of the allocator. */
+    void (*init)(void);                                                   /*!< Function called before every run. */
+    void *(*alloc)(size_t size);                                          /*!< Function allocating a single item. */
+    void (*release)(void);                                                /*!< Function releasing all the items. */
+    bool (*overhead)(size_t requested, size_t heap, long long *overhead); /*!< Function measuring the memory used on top of the requested one. */
+};
+
+/*! @} */
+
+/*!
+ * \brief Results of a single benchmark.
+ */
+struct BenchmarkResult {
+    uint64_t alloc;     /*!< The total allocation time. */
+    uint64_t release;   /*!< The total release time. */
+    size_t peak;        /*!< The peak resident memory in KiB. */
+    size_t requested;   /*!< The requested memory in bytes. */
+    size_t heap;        /*!< The heap memory used in bytes. */
+    long long overhead; /*!< The memory used on top of the requested one in bytes. */
+    bool measured;      /*!< True if the overhead was measured. */
+    size_t failures;    /*!< The number of failed allocations. */
+};
+
+/*!
+ * \brief Run a single allocation and release cycle.
+ *
+ * \param[in] allocator    The allocator under test.
+ * \param[in] distribution The allocation size distribution.
+ * \return The results of the run.
+ */
+static struct BenchmarkResult benchmark_run(const struct BenchmarkAllocator *allocator, const struct BenchmarkDistribution *distribution) {
+    struct BenchmarkResult result = { 0 };
+    uint32_t state = 0x12345678U;
+    volatile unsigned char sink = 0U;
+
+    benchmark_peak_reset();
+    const size_t heap = benchmark_heap_get();
+    allocator->init();
+
+    const uint64_t start = benchmark_clock_now();
+    for (size_t i = 0U; i < distribution->items; ++i) {
+        const size_t size = distribution->next(&state);
+        unsigned char *item = (unsigned char *)allocator->alloc(size);
+        if (item == NULL) {
+            ++result.failures;
+            continue;
+        }
+        /*! Touch the memory so that the allocation is not optimized away */
+        item[0U] = (unsigned char)i;
+        sink ^= item[0U];
+        result.requested += size;
+    }
+    const uint64_t middle = benchmark_clock_now();
+    result.heap = benchmark_heap_get() - heap;
+    result.peak = benchmark_peak_get();
+    result.measured = allocator->overhead(result.requested, result.heap, &result.overhead);
+    allocator->release();
+    const uint64_t end = benchmark_clock_now();
+
+    (void)sink;
+    result.alloc = middle - start;
+    result.release = end - middle;
+    return result;
+}
+
+/*!
+ * \brief Run an allocator against a distribution and print the best results.
+ *
+ * \param[in] allocator    The allocator under test.
+ * \param[in] distribution The allocation size distribution.
+ */
+static void benchmark_print(const struct BenchmarkAllocator *allocator, const struct BenchmarkDistribution *distribution) {
+    struct BenchmarkResult best = benchmark_run(allocator, distribution);
+    for (size_t i = 1U; i < BENCHMARK_RUNS; ++i) {
+        struct BenchmarkResult result = benchmark_run(allocator, distribution);
+        if (result.alloc + result.release < best.alloc + best.release) {
+            best = result;
+        }
+    }
+    const double items = (double)distribution->items;
+    char overhead[24] = "n/a";
+    if (best.measured) {
+        (void)snprintf(overhead, sizeof(overhead), "%lld", best.overhead);
+    }
+    printf("%-12s %-20s %12.2f %12.2f %12zu %14s %9zu\n",
+           distribution->name,
+           allocator->name,
+           (double)best.alloc / items,
+           (double)best.release / items,
+           best.peak,
+           overhead,
+           best.failures);
+}
+
+#if defined(__unix__)
+
+/*!
+ * \defgroup threads Concurrent allocation throughput
+ * @{
+ */
+
+static struct ArenaAllocatorConcurrentHandler benchmark_hconcurrent;
+
+/*!
+ * \brief State of a single thread of the concurrent benchmark.
+ */
+struct BenchmarkThread {
+    void *items[BENCHMARK_ITEMS]; /*!< The items allocated by the thread. */
+    size_t failures;              /*!< The number of failed allocations. */
+};
+
+/*!
+ * \brief Allocate small items from a thread using the concurrent arena.
+ */
+static void *benchmark_thread_arena(void *arg) {
+    struct BenchmarkThread *thread = (struct BenchmarkThread *)arg;
+    struct ArenaAllocatorConcurrentCache hcache;
+    volatile unsigned char sink = 0U;
+    arena_allocator_concurrent_api_cache_init(&hcache, &benchmark_hconcurrent);
+    for (size_t i = 0U; i < BENCHMARK_ITEMS; ++i) {
+        unsigned char *item = (unsigned char *)arena_allocator_concurrent_api_alloc(&hcache, 16U);
+        if (item == NULL) {
+            ++thread->failures;
+            continue;
+        }
+        item[0U] = (unsigned char)i;
+        sink ^= item[0U];
+    }
+    (void)sink;
+    return NULL;
+}
+
+/*!
+ * \brief Allocate small items from a thread using malloc, the items are freed
+ *      by the same thread at the end.
+ */
+static void *benchmark_thread_malloc(void *arg) {
+    struct BenchmarkThread *thread = (struct BenchmarkThread *)arg;
+    volatile unsigned char sink = 0U;
+    for (size_t i = 0U; i < BENCHMARK_ITEMS; ++i) {
+        unsigned char *item = (unsigned char *)malloc(16U);
+        thread->items[i] = item;
+        if (item == NULL) {
+            ++thread->failures;
+            continue;
+        }
+        item[0U] = (unsigned char)i;
+        sink ^= item[0U];
+    }
+    for (size_t i = 0U; i < BENCHMARK_ITEMS; ++i) {
+        free(thread->items[i]);
+    }
+    (void)sink;
+    return NULL;
+}
+
+/*!
+ * \brief Measure the allocation throughput with an increasing number of
+ *      threads.
+ */
+static void benchmark_threads(void) {
+    static struct BenchmarkThread states[BENCHMARK_MAX_THREADS];
+    pthread_t threads[BENCHMARK_MAX_THREADS];
+
+    printf("\n%-8s %22s %22s %9s\n", "threads", "arena (Malloc/s)", "malloc (Malloc/s)", "failures");
+    for (size_t count = 1U; count <= BENCHMARK_MAX_THREADS; count *= 2U) {
+        for (size_t i = 0U; i < count; ++i) {
+            states[i].failures = 0U;
+        }
+        arena_allocator_concurrent_api_init(&benchmark_hconcurrent);
+        uint64_t start = benchmark_clock_now();
+        for (size_t i = 0U; i < count; ++i) {
+            pthread_create(&threads[i], NULL, benchmark_thread_arena, &states[i]);
+        }
+        for (size_t i = 0U; i < count; ++i) {
+            pthread_join(threads[i], NULL);
+        }
+        arena_allocator_concurrent_api_free(&benchmark_hconcurrent);
+        const uint64_t arena = benchmark_clock_now() - start;
+
+        start = benchmark_clock_now();
+        for (size_t i = 0U; i < count; ++i) {
+            pthread_create(&threads[i], NULL, benchmark_thread_malloc, &states[i]);
+        }
+        for (size_t i = 0U; i < count; ++i) {
+            pthread_join(threads[i], NULL);
+        }
+        const uint64_t system = benchmark_clock_now() - start;
+
+        size_t failures = 0U;
+        for (size_t i = 0U; i < count; ++i) {
+            failures += states[i].failures;
+        }
+        const double total = (double)(count * BENCHMARK_ITEMS) * 1000.0;
+        printf("%-8zu %22.2f %22.2f %9zu\n", count, total / (double)arena, total / (double)system, failures);
+    }
+}
+
+/*! @} */
+
+#endif // __unix__
+
+#if defined(__linux__)
+
+/*!
+ * \defgroup scan Scan throughput of large arenas
+ * @{
+ */
+
+/*!
+ * \brief Item visited by the scan benchmark.
+ */
+struct BenchmarkNode {
+    struct BenchmarkNode *next; /*!< The next item to visit. */
+    uint64_t value;             /*!< The payload of the item. */
+};
+
+/*!
+ * \brief Build a list of small items linked in random order and measure the
+ *      time needed to walk it.
+ * \details Visiting the items in random order stresses the TLB so that the
+ *      benefit of huge pages and local NUMA memory is visible.
+ *
+ * \param[in] name   The name of the configuration.
+ * \param[in] harena A reference to an initialized arena.
+ */
+static void benchmark_scan_run(const char *name, struct ArenaAllocatorHandler *harena) {
+    struct BenchmarkNode **nodes = (struct BenchmarkNode **)malloc(BENCHMARK_SCAN_ITEMS * sizeof(*nodes));
+    uint32_t state = 1U;
+    if (nodes == NULL) {
+        return;
+    }
+    for (size_t i = 0U; i < BENCHMARK_SCAN_ITEMS; ++i) {
+        nodes[i] = ARENA_NEW(harena, struct BenchmarkNode);
+        if (nodes[i] == NULL) {
+            printf("%-20s %18s\n", name, "unavailable");
+            free(nodes);
+            return;
+        }
+        nodes[i]->value = i;
+    }
+    for (size_t i = BENCHMARK_SCAN_ITEMS - 1U; i > 0U; --i) {
+        const size_t j = benchmark_random(&state) % (i + 1U);
+        struct BenchmarkNode *tmp = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = tmp;
+    }
+    for (size_t i = 0U; i < BENCHMARK_SCAN_ITEMS; ++i) {
+        nodes[i]->next = i + 1U < BENCHMARK_SCAN_ITEMS ? nodes[i + 1U] : NULL;
+    }
+    struct BenchmarkNode *head = nodes[0U];
+    free(nodes);
+
+    uint64_t best = UINT64_MAX;
+    volatile uint64_t sink = 0U;
+    for (size_t run = 0U; run < BENCHMARK_RUNS; ++run) {
+        const uint64_t start = benchmark_clock_now();
+        uint64_t sum = 0U;
+        for (struct BenchmarkNode *node = head; node != NULL; node = node->next) {
+            sum += node->value;
+        }
+        const uint64_t elapsed = benchmark_clock_now() - start;
+        sink = sum;
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    (void)sink;
+    printf("%-20s %18.2f\n", name, (double)best / BENCHMARK_SCAN_ITEMS);
+}
+
+/*!
+ * \brief Compare the scan throughput of the arena with different kinds of
+ *      pages and NUMA placement.
+ */
+static void benchmark_scan(void) {
+    const struct {
+        const char *name;
+        struct ArenaAllocatorConfig config;
+    } configs[] = {
+        { "vm", { .pages = ARENA_ALLOCATOR_PAGES_DEFAULT } },
+        { "vm-thp", { .pages = ARENA_ALLOCATOR_PAGES_TRANSPARENT_HUGE } },
+        { "vm-hugetlb", { .pages = ARENA_ALLOCATOR_PAGES_HUGETLB } },
+        { "vm-thp-numa0", { .pages = ARENA_ALLOCATOR_PAGES_TRANSPARENT_HUGE, .numa_bind = true, .numa_node = 0U } },
+    };
+    struct ArenaAllocatorHandler harena;
+
+    printf("\n%-20s %18s\n", "scan", BENCHMARK_UNIT "/item");
+    arena_allocator_api_init(&harena);
+    benchmark_scan_run("heap", &harena);
+    arena_allocator_api_free(&harena);
+    for (size_t i = 0U; i < sizeof(configs) / sizeof(*configs); ++i) {
+        if (!arena_allocator_api_init_vm_with_config(&harena, BENCHMARK_SCAN_ITEMS * 2U * sizeof(struct BenchmarkNode), &configs[i].config)) {
+            printf("%-20s %18s\n", configs[i].name, "unavailable");
+            continue;
+        }
+        benchmark_scan_run(configs[i].name, &harena);
+        arena_allocator_api_free(&harena);
+    }
+}
+
+/*! @} */
+
+#endif // __linux__
+
+int main(void) {
+    const struct BenchmarkDistribution distributions[] = {
+        { "small", benchmark_size_small, BENCHMARK_ITEMS },
+        { "power-law", benchmark_size_power_law, BENCHMARK_ITEMS },
+        { "large", benchmark_size_large, BENCHMARK_ITEMS / 50U },
+    };
+    const struct BenchmarkAllocator allocators[] = {
+        { "malloc", benchmark_malloc_init, benchmark_malloc_alloc, benchmark_malloc_release, benchmark_malloc_overhead },
+        { "arena", benchmark_arena_init, benchmark_arena_alloc, benchmark_arena_release, benchmark_arena_overhead },
+        { "arena-chunked", benchmark_arena_chunked_init, benchmark_arena_alloc, benchmark_arena_release, benchmark_arena_overhead },
+        { "arena-1MiB-blocks", benchmark_arena_large_block_init, benchmark_arena_alloc, benchmark_arena_release, benchmark_arena_overhead },
+        { "arena-static", benchmark_arena_static_init, benchmark_arena_alloc, benchmark_arena_release, benchmark_arena_overhead },
+#if defined(__linux__)
+        { "arena-vm", benchmark_arena_vm_init, benchmark_arena_alloc, benchmark_arena_release, benchmark_arena_overhead },
+#endif // __linux__
+    };
+
+    benchmark_clock_init();
+    /*! The static arena is skipped when there is not enough memory for its buffer */
+    benchmark_buffer = (unsigned char *)malloc(BENCHMARK_STATIC_SIZE);
+
+    printf("%-12s %-20s %12s %12s %12s %14s %9s\n",
+           "sizes",
+           "allocator",
+           BENCHMARK_UNIT "/alloc",
+           BENCHMARK_UNIT "/free",
+           "peak KiB",
+           "overhead B",
+           "failures");
+    for (size_t d = 0U; d < sizeof(distributions) / sizeof(*distributions); ++d) {
+        for (size_t a = 0U; a < sizeof(allocators) / sizeof(*allocators); ++a) {
+            if (allocators[a].init == benchmark_arena_static_init && benchmark_buffer == NULL) {
+                printf("%-12s %-20s %12s\n", distributions[d].name, allocators[a].name, "unavailable");
+                continue;
+            }
+            benchmark_print(&allocators[a], &distributions[d]);
+        }
+    }
+    free(benchmark_buffer);
+
+#if defined(__unix__)
+    benchmark_threads();
+#endif // __unix__
+#if defined(__linux__)
+    benchmark_scan();
+#endif // __linux__
+    return 0;
+}
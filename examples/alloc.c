@@ -38,8 +38,8 @@ int main(void) {
     struct ArenaAllocatorHandler harena;
     arena_allocator_api_init(&harena);
 
-    struct Vec3 *v = (struct Vec3 *)arena_allocator_api_alloc(&harena, sizeof(*v));
-    float *k = (float *)arena_allocator_api_alloc(&harena, sizeof(*k));
+    struct Vec3 *v = ARENA_NEW(&harena, struct Vec3);
+    float *k = ARENA_NEW(&harena, float);
 
     /*! Initialization of the vector and scalar values */
     v->x = 1.53f;
@@ -52,7 +52,7 @@ int main(void) {
     printf(" = ");
 
     /*! Allocate and calculate a vector multiplication with a scalar value */
-    struct Vec3 *w = (struct Vec3 *)arena_allocator_api_alloc(&harena, sizeof(*w));
+    struct Vec3 *w = ARENA_NEW(&harena, struct Vec3);
     w->x = v->x * (*k);
     w->y = v->y * (*k);
     w->z = v->z * (*k);
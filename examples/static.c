@@ -0,0 +1,64 @@
+/*!
+ * \file static.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Simple example of allocations served entirely from a static buffer
+ *      using the arena allocator.
+ * \details In the example the arena is initialized over a statically allocated
+ *      buffer so that the heap is never used, a moving average filter is then
+ *      allocated inside the arena and applied to a simple signal.
+ *      Once the buffer is exhausted every allocation fails, this is shown at
+ *      the end of the program.
+ */
+#include <stdio.h>
+
+#include "arena-allocator.h"
+#include "arena-allocator-api.h"
+
+/*! Size of the buffer used by the arena */
+#define BUFFER_SIZE (512U)
+
+/*! Memory used by the arena, no heap allocation is ever done */
+static unsigned char buffer[BUFFER_SIZE];
+
+int main(void) {
+    struct ArenaAllocatorHandler harena;
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+
+    /*! Length of the signal and of the moving average window */
+    const int N = 16;
+    const int W = 4;
+
+    float *signal = (float *)arena_allocator_api_calloc(&harena, sizeof(*signal), N);
+    float *filtered = (float *)arena_allocator_api_calloc(&harena, sizeof(*filtered), N);
+    if (signal == NULL || filtered == NULL) {
+        printf("Buffer too small\n");
+        return 1;
+    }
+
+    for (int i = 0; i < N; ++i) {
+        signal[i] = (i % 2 == 0) ? 1.f : 0.f;
+    }
+
+    /*! Calculation of the moving average over the last W samples */
+    printf("y = [ ");
+    for (int i = 0; i < N; ++i) {
+        float sum = 0.f;
+        int count = 0;
+        for (int j = i; j >= 0 && j > i - W; --j, ++count) {
+            sum += signal[j];
+        }
+        filtered[i] = sum / (float)count;
+        printf("%.2f ", filtered[i]);
+    }
+    printf("]\n");
+
+    /*! Allocations bigger than the remaining buffer always fail */
+    void *too_big = arena_allocator_api_alloc(&harena, BUFFER_SIZE);
+    printf("Allocation bigger than the buffer: %s\n", too_big == NULL ? "failed" : "succeeded");
+
+    /*! Freeing the arena empties the buffer so that it can be used again */
+    arena_allocator_api_free(&harena);
+    return 0;
+}
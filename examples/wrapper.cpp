@@ -0,0 +1,94 @@
+/*!
+ * \file wrapper.cpp
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Simple example of standard containers built on top of the arena
+ *      allocator using the C++ wrapper.
+ * \details In the example a list of names is stored inside containers which
+ *      take their memory from an arena, both through the polymorphic memory
+ *      resource and through the stateful allocator, temporary objects are then
+ *      released by rewinding the arena to a save point.
+ *      The thread safe and the ring arenas are used from C++ as well.
+ *      At the end of the program all the memory is freed by the destructor of
+ *      the arena.
+ */
+#include <cstdio>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "arena-allocator.hpp"
+#include "arena-allocator-concurrent-api.h"
+#include "arena-allocator-ring-api.h"
+
+/*!
+ * \brief Object with a destructor allocated inside the arena
+ */
+struct Counter {
+    static int destroyed; /*!< The number of objects destroyed so far */
+    int value;            /*!< The value of the object */
+
+    explicit Counter(int value) : value(value) {
+    }
+
+    ~Counter() {
+        ++destroyed;
+    }
+};
+
+int Counter::destroyed = 0;
+
+int main() {
+    arena_allocator::Arena arena;
+
+    /*! Containers using the arena as a polymorphic memory resource */
+    std::pmr::vector<std::pmr::string> names(&arena);
+    for (int i = 0; i < 100; ++i) {
+        names.emplace_back("signal number " + std::to_string(i) + " of the frame");
+    }
+
+    /*! Containers using the stateful allocator */
+    using Allocator = arena_allocator::Allocator<std::pair<const int, int>>;
+    std::map<int, int, std::less<int>, Allocator> lengths{ Allocator(arena) };
+    for (int i = 0; i < 100; ++i) {
+        lengths[i] = static_cast<int>(names[i].size());
+    }
+    std::printf("%s has %d characters\n", names[42].c_str(), lengths[42]);
+
+    /*! Objects allocated after a save point are destroyed by a rewind */
+    const ArenaAllocatorMark mark = arena.mark();
+    const Counter *counter = arena.make<Counter>(7);
+    std::printf("Temporary counter: %d\n", counter->value);
+    arena.rewind(mark);
+    std::printf("Destroyed counters: %d\n", Counter::destroyed);
+
+    /*! The thread safe arena shares its structures with C */
+    ArenaAllocatorConcurrentHandler hconcurrent;
+    ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    int *shared = static_cast<int *>(arena_allocator_concurrent_api_alloc(&hcache, sizeof(int)));
+
+    /*! The ring arena passes messages without copies */
+    alignas(ARENA_ALLOCATOR_ALIGNMENT) static unsigned char buffer[256U];
+    ArenaAllocatorRingHandler hring;
+    int *message = nullptr;
+    if (arena_allocator_ring_api_init(&hring, buffer, sizeof(buffer))) {
+        message = static_cast<int *>(arena_allocator_ring_api_alloc(&hring, sizeof(int)));
+    }
+    if (shared == nullptr || message == nullptr) {
+        std::printf("Allocation failed\n");
+        arena_allocator_concurrent_api_free(&hconcurrent);
+        return 1;
+    }
+    *message = 42;
+    arena_allocator_ring_api_commit(&hring);
+    std::printf("Message: %d\n", *static_cast<const int *>(arena_allocator_ring_api_peek(&hring, nullptr)));
+    (void)arena_allocator_ring_api_release(&hring);
+
+    /*! The thread safe arena must be freed explicitly */
+    arena_allocator_concurrent_api_free(&hconcurrent);
+    return Counter::destroyed == 1 ? 0 : 1;
+}
@@ -9,9 +9,11 @@
  *     efficiently.
  *     This method allows for faster allocation and deallocation since all
  *     memory can be freed at once when the arena is no longer needed.
- *     This implementation of the allocator uses a dynamic array which gets
- *     reallocated when more memory is needed to keep track of all the
- *     allocated memory.
+ *     This implementation of the allocator carves the items out of large
+ *     memory blocks by simply advancing an offset (bump allocation); a new
+ *     block is requested only when the current one is exhausted and all the
+ *     blocks are tracked by a dynamic array which gets reallocated when more
+ *     blocks are needed.
  *
  * \warning Memory handled by the arena allocator should not be freed outside
  *      of the allocator itself.
@@ -21,8 +23,16 @@
 #ifndef ARENA_ALLOCATOR_API_H
 #define ARENA_ALLOCATOR_API_H
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
 #include "arena-allocator.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
 /*!
  * \brief Initialize the arena allocator handler.
  *
@@ -33,8 +43,115 @@
  */
 void arena_allocator_api_init(struct ArenaAllocatorHandler *harena);
 
+/*!
+ * \brief Initialize the arena allocator handler with a custom configuration.
+ * \details The configuration sets how the array used to keep track of the
+ *      blocks grows (e.g. to pre-size it or to limit the unused memory on
+ *      constrained targets) and the minimum size of the blocks.
+ *
+ * \attention This function can be called instead of \ref arena_allocator_api_init.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] config A reference to the configuration, NULL for the default one.
+ */
+void arena_allocator_api_init_with_config(struct ArenaAllocatorHandler *harena, const struct ArenaAllocatorConfig *config);
+
+/*!
+ * \brief Initialize the arena allocator handler over a caller supplied buffer.
+ * \details Every item is allocated from the given buffer (e.g. a static array,
+ *      a linker section or a dedicated RAM region) and the heap is never used,
+ *      once the buffer is exhausted every allocation fails.
+ *      A small part of the buffer is used to keep track of the buffer itself.
+ *
+ * \attention The buffer must outlive the arena and should not be accessed
+ *      directly while the arena is in use.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] buffer A reference to the memory used by the arena.
+ * \param[in] size   The size of the buffer in **bytes**.
+ */
+void arena_allocator_api_init_static(struct ArenaAllocatorHandler *harena, void *buffer, size_t size);
+
+/*!
+ * \brief Initialize the arena allocator handler over a range of virtual
+ *      memory reserved once from the system.
+ * \details The whole range is reserved without being backed by physical
+ *      memory, which is committed only while the items are allocated, so that
+ *      very large arenas are contiguous and their items never move.
+ *      A reset gives all the committed memory back to the system while the
+ *      range itself stays reserved until the arena is freed.
+ *
+ * \note Only available on Linux, on other systems the initialization always
+ *      fails.
+ *
+ * \attention After a failed initialization or once the arena is freed every
+ *      allocation fails until the arena is initialized again.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of the range of virtual memory in **bytes**.
+ * \return True on success, false if the range can't be reserved.
+ */
+bool arena_allocator_api_init_vm(struct ArenaAllocatorHandler *harena, size_t size);
+
+/*!
+ * \brief Initialize the arena allocator handler over a range of virtual
+ *      memory with a custom configuration.
+ * \details Same as \ref arena_allocator_api_init_vm, the configuration also
+ *      selects the kind of pages backing the memory (huge pages reduce the
+ *      TLB pressure when scanning many items) and the NUMA node the memory is
+ *      bound to.
+ *      With huge pages the size of the range is rounded up to
+ *      \ref ARENA_ALLOCATOR_VM_COMMIT_SIZE which must be a multiple of the
+ *      huge page size.
+ *
+ * \note Only available on Linux, on other systems the initialization always
+ *      fails.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of the range of virtual memory in **bytes**.
+ * \param[in] config A reference to the configuration or NULL to use the default one.
+ * \return True on success, false if the range can't be reserved, huge pages
+ *      from the reserved pool are not available or the memory can't be bound
+ *      to the NUMA node.
+ */
+bool arena_allocator_api_init_vm_with_config(struct ArenaAllocatorHandler *harena, size_t size, const struct ArenaAllocatorConfig *config);
+
+/*!
+ * \brief Initialize the arena allocator handler as a child of another arena.
+ * \details The blocks of the child (and the memory used to keep track of
+ *      them) are carved out of the parent, so that temporary arenas never
+ *      request memory to the system.
+ *      When the child is freed its memory is given back to the parent if
+ *      nothing else was allocated from the parent after the child blocks,
+ *      otherwise it is released together with the parent.
+ *
+ * \attention The parent should not be reset, rewound or freed while the child
+ *      is in use, freeing the root arena releases the memory of all its
+ *      children at once.
+ *
+ * \param[in] harena A reference to the child arena allocator handler.
+ * \param[in] parent A reference to the parent arena allocator handler.
+ */
+void arena_allocator_api_init_child(struct ArenaAllocatorHandler *harena, struct ArenaAllocatorHandler *parent);
+
+/*!
+ * \brief Reserve room for the given number of blocks in the array used to keep
+ *      track of them.
+ * \details The array is reallocated only once, regardless of the growth
+ *      policy of the arena.
+ *
+ * \param[in] harena   A reference to the arena allocator handler.
+ * \param[in] capacity The minimum number of blocks which can be tracked.
+ * \return True on success, false if the array can't grow to the requested
+ *      capacity.
+ */
+bool arena_allocator_api_reserve(struct ArenaAllocatorHandler *harena, size_t capacity);
+
 /*!
  * \brief Allocate a single item using the arena allocator.
+ * \details The item is carved out of the current memory block of the arena,
+ *      a new block is allocated only when the current one is exhausted.
+ *      The returned memory is aligned to \ref ARENA_ALLOCATOR_ALIGNMENT.
  *
  * \attention The returned reference should be casted to the appropriate type.
  *
@@ -44,20 +161,329 @@ void arena_allocator_api_init(struct ArenaAllocatorHandler *harena);
  */
 void *arena_allocator_api_alloc(struct ArenaAllocatorHandler *harena, size_t size);
 
+/*!
+ * \brief Allocate a single item with a specific alignment using the arena
+ *      allocator.
+ * \details Same as \ref arena_allocator_api_alloc but the returned memory is
+ *      aligned to the given value (e.g. for SIMD buffers, DMA descriptors or
+ *      cache line sized data), the needed padding is taken from the arena.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \return A pointer to the allocated memory region or NULL on failure.
+ */
+void *arena_allocator_api_alloc_aligned(struct ArenaAllocatorHandler *harena, size_t size, size_t align);
+
 /*!
  * \brief Allocate multiple items at once using the arena allocator.
+ * \details Like the standard calloc the returned memory is zero initialized,
+ *      memory which is known to be already zeroed (e.g. fresh blocks) is not
+ *      cleared again.
  *
  * \attention The returned reference should be casted to the appropriate type.
  *
  * \param[in] harena A reference to the arena allocator handler.
  * \param[in] size   The amount of memory to allocate for a single item in **bytes**.
  * \param[in] count  The number of items to allocate.
- * \return A pointer to the allocated memory region or NULL on failure.
+ * \return A pointer to the allocated memory region or NULL on failure (also
+ *      if size * count overflows).
  */
 void *arena_allocator_api_calloc(struct ArenaAllocatorHandler *harena, size_t size, size_t count);
 
+/*!
+ * \brief Allocate multiple items at once with a specific alignment using the
+ *      arena allocator.
+ * \details Same as \ref arena_allocator_api_calloc but the returned memory is
+ *      aligned to the given value, the needed padding is taken from the arena.
+ *      The returned memory is zero initialized.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate for a single item in **bytes**.
+ * \param[in] count  The number of items to allocate.
+ * \param[in] align  The alignment of the first item in **bytes**, must be a power of two.
+ * \return A pointer to the allocated memory region or NULL on failure.
+ */
+void *arena_allocator_api_calloc_aligned(struct ArenaAllocatorHandler *harena, size_t size, size_t count, size_t align);
+
+/*!
+ * \brief Allocate a batch of items of different sizes at once using the arena
+ *      allocator.
+ * \details The space for all the items is reserved with a single carve from
+ *      the arena and then split into consecutive items, each aligned to
+ *      \ref ARENA_ALLOCATOR_ALIGNMENT, so that the bookkeeping cost is paid
+ *      once for the whole batch. The memory is not initialized.
+ *
+ * \note Either all the items are allocated or none of them is, in debug mode
+ *      the guard bytes surround the whole batch.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] sizes  The sizes of the items in **bytes**, all greater than zero.
+ * \param[in] count  The number of items to allocate.
+ * \param[out] items The array where the references to the items are stored.
+ * \return True if all the items are allocated, false otherwise.
+ */
+bool arena_allocator_api_alloc_batch(struct ArenaAllocatorHandler *harena, const size_t *sizes, size_t count, void **items);
+
+/*!
+ * \brief Allocate a batch of items of the same size at once using the arena
+ *      allocator.
+ * \details Same as \ref arena_allocator_api_alloc_batch with every item of
+ *      the given size.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of every item in **bytes**.
+ * \param[in] count  The number of items to allocate.
+ * \param[out] items The array where the references to the items are stored.
+ * \return True if all the items are allocated, false otherwise (also if the
+ *      total size overflows).
+ */
+bool arena_allocator_api_alloc_n(struct ArenaAllocatorHandler *harena, size_t size, size_t count, void **items);
+
+/*!
+ * \brief Allocate a single item using the arena allocator and get its offset
+ *      instead of its address.
+ * \details Offsets take 32 bits instead of a full pointer, which makes links
+ *      between the items of large graphs (e.g. tries or lists) smaller, and
+ *      they stay valid if the content of the arena is moved to another
+ *      address. An offset is turned into a pointer by
+ *      \ref arena_allocator_api_resolve.
+ *      Offsets are counted from \ref ARENA_ALLOCATOR_ALIGNMENT **bytes**
+ *      before the start of the arena, so that zero is never a valid offset
+ *      and every offset has the same alignment as its item.
+ *
+ * \note Only the arenas made of a single memory region (over a caller
+ *      supplied buffer or a range of virtual memory) support offsets, which
+ *      can reach only the first 4 GiB of the region.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \return The offset of the allocated item or zero on failure.
+ */
+uint32_t arena_allocator_api_alloc_offset(struct ArenaAllocatorHandler *harena, size_t size);
+
+/*!
+ * \brief Allocate a single item with a specific alignment using the arena
+ *      allocator and get its offset instead of its address.
+ * \details Same as \ref arena_allocator_api_alloc_offset but the item is
+ *      aligned to the given value.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \return The offset of the allocated item or zero on failure.
+ */
+uint32_t arena_allocator_api_alloc_offset_aligned(struct ArenaAllocatorHandler *harena, size_t size, size_t align);
+
+/*!
+ * \brief Get the offset of an item previously allocated by the arena
+ *      allocator.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] item   A reference to the item.
+ * \return The offset of the item or zero if the arena does not support
+ *      offsets or the item does not belong to it.
+ */
+uint32_t arena_allocator_api_offset(const struct ArenaAllocatorHandler *harena, const void *item);
+
+/*!
+ * \brief Resize an item previously allocated by the arena allocator.
+ * \details If the item is the last one allocated in the current block it is
+ *      grown or shrunk in place when it fits, otherwise a new item is
+ *      allocated and the content of the old one is copied into it (the old
+ *      item is released only when the whole arena is).
+ *      Items which are shrunk and can't be resized in place are not moved.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena   A reference to the arena allocator handler.
+ * \param[in] item     A reference to the item to resize or NULL to allocate a new one.
+ * \param[in] old_size The current size of the item in **bytes**.
+ * \param[in] new_size The new size of the item in **bytes**.
+ * \return A pointer to the resized item or NULL on failure, in which case the
+ *      old item is left untouched.
+ */
+void *arena_allocator_api_realloc(struct ArenaAllocatorHandler *harena, void *item, size_t old_size, size_t new_size);
+
+/*!
+ * \brief Allocate a single item with a cleanup callback using the arena
+ *      allocator.
+ * \details Same as \ref arena_allocator_api_alloc, the callback is run with
+ *      the item when it is released by a rewind, a reset or a free of the
+ *      arena, callbacks are run in reverse order of registration.
+ *      Items allocated without a callback have no extra cost.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \param[in] dtor   The function called when the item is released or NULL for none.
+ * \return A pointer to the allocated memory region or NULL on failure.
+ */
+void *arena_allocator_api_alloc_with_dtor(struct ArenaAllocatorHandler *harena, size_t size, void (*dtor)(void *item));
+
+/*!
+ * \brief Register a cleanup callback run when the arena releases its items.
+ * \details The callback is run with the given item by the first rewind to a
+ *      mark taken before the registration, reset or free of the arena.
+ *      The record of the callback is allocated inside the arena itself.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] item   The item passed to the callback, not necessarily allocated by the arena.
+ * \param[in] dtor   The function called when the items are released.
+ * \return True on success, false if the record can't be allocated.
+ */
+bool arena_allocator_api_on_free(struct ArenaAllocatorHandler *harena, void *item, void (*dtor)(void *item));
+
+/*!
+ * \brief Save the current state of the arena allocator.
+ * \details The returned mark can be later passed to
+ *      \ref arena_allocator_api_rewind to release every item allocated after
+ *      this call while keeping the ones allocated before it.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \return The mark of the current state of the arena.
+ */
+struct ArenaAllocatorMark arena_allocator_api_mark(const struct ArenaAllocatorHandler *harena);
+
+/*!
+ * \brief Release all the items allocated after the given mark was taken.
+ * \details Blocks pushed after the mark are kept by the arena and reused by
+ *      the following allocations, the cost of the operation is constant and
+ *      does not depend on the number of items.
+ *      Marks taken after the given one become invalid, invalid marks are
+ *      ignored.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] mark   The mark previously returned by \ref arena_allocator_api_mark.
+ */
+void arena_allocator_api_rewind(struct ArenaAllocatorHandler *harena, struct ArenaAllocatorMark mark);
+
+/*!
+ * \brief Release all the items allocated by the arena allocator while keeping
+ *      its memory.
+ * \details All the blocks and the array used to track them are kept and
+ *      reused by the following allocations, each item going in the smallest
+ *      kept block which fits it, so that loops which fill and reset the same
+ *      arena stop requesting memory after the first iteration.
+ *      Items which fit none of the kept blocks get a new block rounded up to a
+ *      multiple of the block size, so that items of varying size stop
+ *      requesting memory as well once the biggest one was seen.
+ *
+ * \note Use \ref arena_allocator_api_free to give the memory back.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ */
+void arena_allocator_api_reset(struct ArenaAllocatorHandler *harena);
+
+/*!
+ * \brief Get the usage statistics of the arena allocator.
+ * \details Useful to size static arenas from real high water marks or to spot
+ *      pathological growth, every field is 0 if the statistics are disabled.
+ *
+ * \note Statistics are collected only if the ARENA_ALLOCATOR_STATS macro is
+ *      defined at compile time.
+ *
+ * \param[in]  harena A reference to the arena allocator handler.
+ * \param[out] stats  A reference to the structure where the statistics are copied.
+ * \return True if the statistics are available, false otherwise.
+ */
+bool arena_allocator_api_get_stats(const struct ArenaAllocatorHandler *harena, struct ArenaAllocatorStats *stats);
+
+/*!
+ * \brief Get one of the memory blocks currently used by the arena.
+ * \details Blocks are numbered in the order they were filled, the size of the
+ *      returned block is the amount of **bytes** used in it, up to the end of
+ *      its last item, so that the unused memory at its end is left out.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] index  The index of the block, must be less than the number of used blocks.
+ * \param[out] block The reference where the block is stored.
+ * \return True if the block exists, false otherwise.
+ */
+bool arena_allocator_api_get_block(const struct ArenaAllocatorHandler *harena, size_t index, struct ArenaAllocatorItem *block);
+
+/*!
+ * \brief Allocate multiple items at once and account them to a call site.
+ * \details When the library is compiled with the ARENA_ALLOCATOR_TRACE macro
+ *      defined the allocation functions and the typed allocation macros are
+ *      replaced by this function, which records the source location of the
+ *      caller together with the requested size.
+ *      Without the macro the allocation is not traced.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate for a single item in **bytes**.
+ * \param[in] count  The number of items to allocate.
+ * \param[in] align  The alignment of the first item in **bytes**, must be a power of two.
+ * \param[in] zeroed True if the memory should be zero initialized.
+ * \param[in] file   The source file of the call site.
+ * \param[in] line   The line of the call site.
+ * \return A pointer to the allocated memory region or NULL on failure (also
+ *      if size * count overflows).
+ */
+void *arena_allocator_api_trace_alloc(struct ArenaAllocatorHandler *harena, size_t size, size_t count, size_t align, bool zeroed, const char *file, unsigned int line);
+
+/*!
+ * \brief Set the call site of the next allocation made from the arena.
+ * \details When the library is compiled with the ARENA_ALLOCATOR_TRACE macro
+ *      defined the allocation functions which do not go through
+ *      \ref arena_allocator_api_trace_alloc are wrapped by macros calling this
+ *      function first, the memory they take from the arena is then accounted
+ *      to the given call site.
+ *      Without the macro nothing is recorded.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] file   The source file of the call site.
+ * \param[in] line   The line of the call site.
+ * \return The given reference to the arena allocator handler.
+ */
+struct ArenaAllocatorHandler *arena_allocator_api_trace_at(struct ArenaAllocatorHandler *harena, const char *file, unsigned int line);
+
+/*!
+ * \brief Export the allocations of the arena aggregated by call site.
+ * \details The profile is written in CSV format with a `file,line,count,bytes`
+ *      header, where count is the number of allocation calls, the call sites
+ *      are sorted from the one which requested the most **bytes**.
+ *      The allocations of the call sites exceeding
+ *      \ref ARENA_ALLOCATOR_TRACE_SITES are reported on a single line with an
+ *      empty file and line.
+ *
+ * \note Allocations are traced only if the ARENA_ALLOCATOR_TRACE macro is
+ *      defined at compile time, the profile is cumulative since the arena was
+ *      initialized.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] file   The file where the profile is written.
+ * \return True on success, false if the allocations are not traced or the
+ *      profile can't be written.
+ */
+bool arena_allocator_api_trace_dump(const struct ArenaAllocatorHandler *harena, FILE *file);
+
+/*!
+ * \brief Verify that the guard bytes around every item of the arena are
+ *      intact.
+ * \details The check is run automatically by \ref arena_allocator_api_reset
+ *      and \ref arena_allocator_api_free, which abort the program (or call
+ *      the ARENA_ALLOCATOR_DEBUG_FAIL macro if defined) on corruption.
+ *
+ * \note Guard bytes are placed only if the ARENA_ALLOCATOR_DEBUG macro is
+ *      defined at compile time, otherwise the check always succeeds.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \return True if no item was written out of its bounds, false otherwise.
+ */
+bool arena_allocator_api_check(const struct ArenaAllocatorHandler *harena);
+
 /*!
  * \brief Free all the memory previously allocated by the arena allocator.
+ * \details Arenas initialized over a caller supplied buffer are emptied and
+ *      can be used again, the buffer itself is never freed.
  *
  * \attention This function should always be called at the end of the program
  *      to correctly free all the previously allocated memory to avoid incurring
@@ -67,4 +493,150 @@ void *arena_allocator_api_calloc(struct ArenaAllocatorHandler *harena, size_t si
  */
 void arena_allocator_api_free(struct ArenaAllocatorHandler *harena);
 
+/*!
+ * \brief Allocate a single item with a specific alignment using the arena
+ *      allocator, inlined in the caller.
+ * \details When the item fits inside the current block of the arena the offset
+ *      is advanced in place without any function call, with a constant size
+ *      and alignment the whole check is folded by the compiler into a single
+ *      comparison; otherwise \ref arena_allocator_api_alloc_aligned is called.
+ *      The fast path is disabled when the statistics are collected or in
+ *      debug mode, it is skipped as well for arenas initialized by a library
+ *      compiled in debug mode.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \return A pointer to the allocated memory region or NULL on failure.
+ */
+static inline void *arena_allocator_api_alloc_inline(struct ArenaAllocatorHandler *harena, size_t size, size_t align) {
+#if !defined(ARENA_ALLOCATOR_STATS) && !defined(ARENA_ALLOCATOR_DEBUG)
+    if (harena != NULL && !harena->debug && harena->current != NULL && size > 0U && align > 0U && (align & (align - 1U)) == 0U) {
+        const struct ArenaAllocatorItem *block = harena->current;
+        const uintptr_t base = (uintptr_t)block->value;
+        const size_t start = (size_t)(((base + harena->offset + align - 1U) & ~((uintptr_t)align - 1U)) - base);
+        if (start <= block->size && size <= block->size - start) {
+            const size_t end = start + size;
+            if (end > harena->clean) {
+                harena->clean = end;
+            }
+            harena->offset = end;
+            return (void *)(base + start);
+        }
+    }
+#endif // ARENA_ALLOCATOR_STATS, ARENA_ALLOCATOR_DEBUG
+    return arena_allocator_api_alloc_aligned(harena, size, align);
+}
+
+/*!
+ * \brief Allocate an array of items with a specific alignment using the arena
+ *      allocator, inlined in the caller.
+ * \details Same as \ref arena_allocator_api_alloc_inline but the size of the
+ *      array is checked for overflow, the memory is not initialized.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of memory to allocate for a single item in **bytes**.
+ * \param[in] count  The number of items to allocate.
+ * \param[in] align  The alignment of the items in **bytes**, must be a power of two.
+ * \return A pointer to the allocated memory region or NULL on failure (also
+ *      if size * count overflows).
+ */
+static inline void *arena_allocator_api_alloc_array_inline(struct ArenaAllocatorHandler *harena, size_t size, size_t count, size_t align) {
+    if (size == 0U || count > SIZE_MAX / size) {
+        return NULL;
+    }
+    return arena_allocator_api_alloc_inline(harena, size * count, align);
+}
+
+/*!
+ * \brief Get the address of an item from its offset, inlined in the caller.
+ * \details The offset is not checked against the used part of the arena.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] offset The offset of the item returned by \ref arena_allocator_api_alloc_offset.
+ * \return A pointer to the item or NULL if the offset is zero.
+ */
+static inline void *arena_allocator_api_resolve(const struct ArenaAllocatorHandler *harena, uint32_t offset) {
+    if (harena == NULL || harena->current == NULL || offset == 0U) {
+        return NULL;
+    }
+    return (uint8_t *)harena->current->value + ((size_t)offset - ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+/*!
+ * \brief Allocate a single item of the given type using the arena allocator.
+ * \details The size and the alignment of the item are taken from the type
+ *      itself, the memory is not initialized.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] T      The type of the item.
+ * \return A pointer to the allocated item or NULL on failure.
+ */
+#ifdef ARENA_ALLOCATOR_TRACE
+#define ARENA_NEW(harena, T) ((T *)arena_allocator_api_trace_alloc((harena), sizeof(T), 1U, ARENA_ALLOCATOR_ALIGNOF(T), false, __FILE__, __LINE__))
+#else
+#define ARENA_NEW(harena, T) ((T *)arena_allocator_api_alloc_inline((harena), sizeof(T), ARENA_ALLOCATOR_ALIGNOF(T)))
+#endif // ARENA_ALLOCATOR_TRACE
+
+/*!
+ * \brief Allocate an array of items of the given type using the arena
+ *      allocator.
+ * \details The size and the alignment of the items are taken from the type
+ *      itself, the memory is not initialized.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] T      The type of the items.
+ * \param[in] n      The number of items to allocate.
+ * \return A pointer to the first allocated item or NULL on failure.
+ */
+#ifdef ARENA_ALLOCATOR_TRACE
+#define ARENA_NEW_ARRAY(harena, T, n) ((T *)arena_allocator_api_trace_alloc((harena), sizeof(T), (n), ARENA_ALLOCATOR_ALIGNOF(T), false, __FILE__, __LINE__))
+#else
+#define ARENA_NEW_ARRAY(harena, T, n) ((T *)arena_allocator_api_alloc_array_inline((harena), sizeof(T), (n), ARENA_ALLOCATOR_ALIGNOF(T)))
+#endif // ARENA_ALLOCATOR_TRACE
+
+/*!
+ * \brief Get the address of an item of the given type from its offset.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] T      The type of the item.
+ * \param[in] offset The offset of the item.
+ * \return A pointer to the item or NULL if the offset is zero.
+ */
+#define ARENA_RESOLVE(harena, T, offset) ((T *)arena_allocator_api_resolve((harena), (offset)))
+
+#ifdef ARENA_ALLOCATOR_TRACE
+/*! The allocations record the source location of the caller */
+#define arena_allocator_api_alloc(harena, size) \
+    arena_allocator_api_trace_alloc((harena), (size), 1U, ARENA_ALLOCATOR_ALIGNMENT, false, __FILE__, __LINE__)
+#define arena_allocator_api_alloc_aligned(harena, size, align) \
+    arena_allocator_api_trace_alloc((harena), (size), 1U, (align), false, __FILE__, __LINE__)
+#define arena_allocator_api_calloc(harena, size, count) \
+    arena_allocator_api_trace_alloc((harena), (size), (count), ARENA_ALLOCATOR_ALIGNMENT, true, __FILE__, __LINE__)
+#define arena_allocator_api_calloc_aligned(harena, size, count, align) \
+    arena_allocator_api_trace_alloc((harena), (size), (count), (align), true, __FILE__, __LINE__)
+#define arena_allocator_api_alloc_batch(harena, sizes, count, items) \
+    arena_allocator_api_alloc_batch(arena_allocator_api_trace_at((harena), __FILE__, __LINE__), (sizes), (count), (items))
+#define arena_allocator_api_alloc_n(harena, size, count, items) \
+    arena_allocator_api_alloc_n(arena_allocator_api_trace_at((harena), __FILE__, __LINE__), (size), (count), (items))
+#define arena_allocator_api_alloc_offset(harena, size) \
+    arena_allocator_api_alloc_offset(arena_allocator_api_trace_at((harena), __FILE__, __LINE__), (size))
+#define arena_allocator_api_alloc_offset_aligned(harena, size, align) \
+    arena_allocator_api_alloc_offset_aligned(arena_allocator_api_trace_at((harena), __FILE__, __LINE__), (size), (align))
+#define arena_allocator_api_realloc(harena, item, old_size, new_size) \
+    arena_allocator_api_realloc(arena_allocator_api_trace_at((harena), __FILE__, __LINE__), (item), (old_size), (new_size))
+#define arena_allocator_api_alloc_with_dtor(harena, size, dtor) \
+    arena_allocator_api_alloc_with_dtor(arena_allocator_api_trace_at((harena), __FILE__, __LINE__), (size), (dtor))
+#endif // ARENA_ALLOCATOR_TRACE
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
 #endif // ARENA_ALLOCATOR_API_H
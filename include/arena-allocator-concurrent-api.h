@@ -0,0 +1,105 @@
+/*!
+ * \file arena-allocator-concurrent-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Thread safe implementation of an arena allocator.
+ * \details The concurrent arena owns a list of large memory blocks shared by
+ *     all the threads, each thread reserves a chunk of the newest block with
+ *     a single atomic operation and then allocates its items from that chunk
+ *     without any synchronization (bump allocation).
+ *     The shared block list is updated only when a chunk is exhausted and a
+ *     new block is pushed without locks when the newest one is full.
+ *     All the memory is freed at once by a single call.
+ *
+ * \warning Memory handled by the arena allocator should not be freed outside
+ *      of the allocator itself.
+ *      This might caused undefined behavior caused by double free of the same
+ *      memory region.
+ */
+#ifndef ARENA_ALLOCATOR_CONCURRENT_API_H
+#define ARENA_ALLOCATOR_CONCURRENT_API_H
+
+#include "arena-allocator-concurrent.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*!
+ * \brief Initialize the concurrent arena allocator handler.
+ *
+ * \attention This function should always be called before every other function
+ *      defined by this library and before the handler is shared between threads.
+ *
+ * \param[in] hconcurrent A reference to the concurrent arena allocator handler.
+ */
+void arena_allocator_concurrent_api_init(struct ArenaAllocatorConcurrentHandler *hconcurrent);
+
+/*!
+ * \brief Initialize a per thread cache of the concurrent arena allocator.
+ * \details The cache is empty, its first chunk is reserved by the first
+ *      allocation.
+ *
+ * \param[in] hcache      A reference to the cache owned by the calling thread.
+ * \param[in] hconcurrent A reference to the concurrent arena allocator handler.
+ */
+void arena_allocator_concurrent_api_cache_init(struct ArenaAllocatorConcurrentCache *hcache, struct ArenaAllocatorConcurrentHandler *hconcurrent);
+
+/*!
+ * \brief Allocate a single item using the concurrent arena allocator.
+ * \details The item is carved out of the chunk of the cache, a new chunk is
+ *      reserved from the shared arena only when the current one is exhausted.
+ *      The returned memory is aligned to \ref ARENA_ALLOCATOR_ALIGNMENT.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hcache A reference to the cache owned by the calling thread.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \return A pointer to the allocated memory region or NULL on failure.
+ */
+void *arena_allocator_concurrent_api_alloc(struct ArenaAllocatorConcurrentCache *hcache, size_t size);
+
+/*!
+ * \brief Allocate a single item with a specific alignment using the
+ *      concurrent arena allocator.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hcache A reference to the cache owned by the calling thread.
+ * \param[in] size   The amount of memory to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \return A pointer to the allocated memory region or NULL on failure.
+ */
+void *arena_allocator_concurrent_api_alloc_aligned(struct ArenaAllocatorConcurrentCache *hcache, size_t size, size_t align);
+
+/*!
+ * \brief Allocate multiple items at once using the concurrent arena allocator.
+ * \details Like the standard calloc the returned memory is zero initialized.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hcache A reference to the cache owned by the calling thread.
+ * \param[in] size   The amount of memory to allocate for a single item in **bytes**.
+ * \param[in] count  The number of items to allocate.
+ * \return A pointer to the allocated memory region or NULL on failure (also
+ *      if size * count overflows).
+ */
+void *arena_allocator_concurrent_api_calloc(struct ArenaAllocatorConcurrentCache *hcache, size_t size, size_t count);
+
+/*!
+ * \brief Free all the memory previously allocated by every thread.
+ *
+ * \attention This function is not thread safe, it should be called only when
+ *      no other thread is using the arena and every cache should be
+ *      initialized again before being used.
+ *
+ * \param[in] hconcurrent A reference to the concurrent arena allocator handler.
+ */
+void arena_allocator_concurrent_api_free(struct ArenaAllocatorConcurrentHandler *hconcurrent);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // ARENA_ALLOCATOR_CONCURRENT_API_H
@@ -0,0 +1,91 @@
+/*!
+ * \file arena-allocator-concurrent.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Thread safe implementation of an arena allocator.
+ * \details The concurrent arena owns a list of large memory blocks shared by
+ *     all the threads, each thread reserves a chunk of the newest block with
+ *     a single atomic operation and then allocates its items from that chunk
+ *     without any synchronization (bump allocation).
+ *     The shared block list is updated only when a chunk is exhausted and a
+ *     new block is pushed without locks when the newest one is full.
+ *     All the memory is freed at once by a single call.
+ *
+ * \warning Memory handled by the arena allocator should not be freed outside
+ *      of the allocator itself.
+ *      This might caused undefined behavior caused by double free of the same
+ *      memory region.
+ */
+#ifndef ARENA_ALLOCATOR_CONCURRENT_H
+#define ARENA_ALLOCATOR_CONCURRENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+#include <atomic>
+#elif !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#endif // __cplusplus
+
+#include "arena-allocator.h"
+
+/*!
+ * \brief Size in **bytes** of the chunks reserved by each thread.
+ * \details Allocations bigger than this value get a dedicated chunk of the
+ *      exact requested size.
+ *      Can be overridden at compile time, it must be a multiple of
+ *      \ref ARENA_ALLOCATOR_ALIGNMENT.
+ */
+#ifndef ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE
+#define ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE (1024U)
+#endif // ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE
+
+/*!
+ * \brief Minimum size in **bytes** of every memory block shared by the
+ *      threads.
+ * \details Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_CONCURRENT_BLOCK_SIZE
+#define ARENA_ALLOCATOR_CONCURRENT_BLOCK_SIZE (65536U)
+#endif // ARENA_ALLOCATOR_CONCURRENT_BLOCK_SIZE
+
+#if defined(__cplusplus) || !defined(__STDC_NO_ATOMICS__)
+
+/*!
+ * \brief Single memory block shared by all the threads.
+ * \details The usable memory of the block follows the structure itself.
+ */
+struct ArenaAllocatorConcurrentBlock {
+    struct ArenaAllocatorConcurrentBlock *next; /*!< The block pushed before this one. */
+    size_t size;                                /*!< The amount of usable memory of the block in **bytes**. */
+    ARENA_ALLOCATOR_ATOMIC(size_t) offset;      /*!< The amount of **bytes** already reserved by the threads. */
+};
+
+/*!
+ * \brief Handler structure of the concurrent arena allocator.
+ * \details The handler is shared by all the threads and contains the list of
+ *      the memory blocks starting from the newest one.
+ */
+struct ArenaAllocatorConcurrentHandler {
+    ARENA_ALLOCATOR_ATOMIC(struct ArenaAllocatorConcurrentBlock *) head; /*!< The newest block of the arena. */
+};
+
+#endif // __STDC_NO_ATOMICS__
+
+/*!
+ * \brief Per thread cache of the concurrent arena allocator.
+ * \details Each thread owns a cache with a chunk of memory reserved from the
+ *      shared arena from which the items are allocated without any
+ *      synchronization.
+ *
+ * \attention A cache must never be used by more than one thread at the same time.
+ */
+struct ArenaAllocatorConcurrentCache {
+    struct ArenaAllocatorConcurrentHandler *hconcurrent; /*!< A reference to the shared arena handler. */
+    uintptr_t cursor;                                    /*!< The address of the first free byte of the chunk. */
+    uintptr_t limit;                                     /*!< The address past the last byte of the chunk. */
+};
+
+#endif // ARENA_ALLOCATOR_CONCURRENT_H
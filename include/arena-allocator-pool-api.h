@@ -0,0 +1,103 @@
+/*!
+ * \file arena-allocator-pool-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Pool allocator layered on top of an arena allocator.
+ * \details The pool serves items of a limited set of size classes (powers of
+ *     two) from an arena and keeps an intrusive free list for each class, so
+ *     that single items can be released and recycled in constant time.
+ *     The memory of the items is never given back to the arena, it is freed
+ *     at once with the arena itself.
+ *
+ * \warning Memory handled by the arena allocator should not be freed outside
+ *      of the allocator itself.
+ *      This might caused undefined behavior caused by double free of the same
+ *      memory region.
+ */
+#ifndef ARENA_ALLOCATOR_POOL_API_H
+#define ARENA_ALLOCATOR_POOL_API_H
+
+#include "arena-allocator-pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*!
+ * \brief Initialize the pool allocator handler.
+ *
+ * \attention The arena must be initialized before the pool and it should not
+ *      be reset, rewound or freed while the pool is in use, otherwise the pool
+ *      must be reset as well.
+ *
+ * \param[in] hpool  A reference to the pool allocator handler.
+ * \param[in] harena A reference to the arena from which the items are allocated.
+ */
+void arena_allocator_pool_api_init(struct ArenaAllocatorPoolHandler *hpool, struct ArenaAllocatorHandler *harena);
+
+/*!
+ * \brief Allocate a single item using the pool allocator.
+ * \details The size is rounded up to its size class, a previously released
+ *      item of the same class is reused if available, otherwise a new one is
+ *      allocated from the arena.
+ *      The returned memory is aligned to \ref ARENA_ALLOCATOR_ALIGNMENT.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hpool A reference to the pool allocator handler.
+ * \param[in] size  The amount of memory to allocate in **bytes**.
+ * \return A pointer to the allocated memory region or NULL on failure (also
+ *      if the size is bigger than the largest size class).
+ */
+void *arena_allocator_pool_api_alloc(struct ArenaAllocatorPoolHandler *hpool, size_t size);
+
+/*!
+ * \brief Allocate a single item using the pool allocator and account the
+ *      memory taken from the arena to the given call site.
+ * \details Same as \ref arena_allocator_pool_api_alloc, which is replaced by
+ *      this function when the ARENA_ALLOCATOR_TRACE macro is defined so that
+ *      the items are traced at the caller of the pool instead of inside it.
+ *      Reused items take no memory from the arena and are not traced.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hpool A reference to the pool allocator handler.
+ * \param[in] size  The amount of memory to allocate in **bytes**.
+ * \param[in] file  The source file of the call site, NULL to skip the tracing.
+ * \param[in] line  The line of the call site.
+ * \return A pointer to the allocated memory region or NULL on failure (also
+ *      if the size is bigger than the largest size class).
+ */
+void *arena_allocator_pool_api_trace_alloc(struct ArenaAllocatorPoolHandler *hpool, size_t size, const char *file, unsigned int line);
+
+/*!
+ * \brief Release a single item so that it can be reused by the pool.
+ *
+ * \attention The size must be the same used to allocate the item.
+ *
+ * \param[in] hpool A reference to the pool allocator handler.
+ * \param[in] item  A reference to the item to release.
+ * \param[in] size  The size of the item in **bytes**.
+ */
+void arena_allocator_pool_api_free(struct ArenaAllocatorPoolHandler *hpool, void *item, size_t size);
+
+/*!
+ * \brief Forget all the released items of the pool.
+ * \details Must be called whenever the underlying arena is reset, rewound or
+ *      freed since the released items are not valid anymore.
+ *
+ * \param[in] hpool A reference to the pool allocator handler.
+ */
+void arena_allocator_pool_api_reset(struct ArenaAllocatorPoolHandler *hpool);
+
+#ifdef ARENA_ALLOCATOR_TRACE
+/*! The allocations record the source location of the caller */
+#define arena_allocator_pool_api_alloc(hpool, size) arena_allocator_pool_api_trace_alloc((hpool), (size), __FILE__, __LINE__)
+#endif // ARENA_ALLOCATOR_TRACE
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // ARENA_ALLOCATOR_POOL_API_H
@@ -0,0 +1,51 @@
+/*!
+ * \file arena-allocator-pool.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Pool allocator layered on top of an arena allocator.
+ * \details The pool serves items of a limited set of size classes (powers of
+ *     two) from an arena and keeps an intrusive free list for each class, so
+ *     that single items can be released and recycled in constant time.
+ *     The memory of the items is never given back to the arena, it is freed
+ *     at once with the arena itself.
+ *
+ * \warning Memory handled by the arena allocator should not be freed outside
+ *      of the allocator itself.
+ *      This might caused undefined behavior caused by double free of the same
+ *      memory region.
+ */
+#ifndef ARENA_ALLOCATOR_POOL_H
+#define ARENA_ALLOCATOR_POOL_H
+
+#include <stddef.h>
+
+#include "arena-allocator.h"
+
+/*!
+ * \brief Number of size classes of the pool.
+ * \details The smallest class is \ref ARENA_ALLOCATOR_ALIGNMENT **bytes**
+ *      and each class is twice as big as the previous one.
+ *      Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_POOL_CLASSES
+#define ARENA_ALLOCATOR_POOL_CLASSES (8U)
+#endif // ARENA_ALLOCATOR_POOL_CLASSES
+
+/*!
+ * \brief Released item of the pool.
+ * \details The node is stored inside the memory of the released item itself.
+ */
+struct ArenaAllocatorPoolNode {
+    struct ArenaAllocatorPoolNode *next; /*!< The next released item of the same size class. */
+};
+
+/*!
+ * \brief Handler structure of the pool allocator.
+ */
+struct ArenaAllocatorPoolHandler {
+    struct ArenaAllocatorHandler *harena;                              /*!< A reference to the arena from which the items are allocated. */
+    struct ArenaAllocatorPoolNode *free[ARENA_ALLOCATOR_POOL_CLASSES]; /*!< The list of the released items for each size class. */
+};
+
+#endif // ARENA_ALLOCATOR_POOL_H
@@ -0,0 +1,97 @@
+/*!
+ * \file arena-allocator-ring-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Lock-free ring arena for a single producer and a single consumer.
+ * \details The ring arena allocates records of variable size over a caller
+ *     supplied buffer: the producer carves them at the head by bumping an
+ *     offset and the consumer releases them from the tail in the same order,
+ *     so that messages are passed between them without copies, locks or
+ *     heap allocations.
+ *     The producer allocates one or more records, fills them and commits
+ *     them, only then they become visible to the consumer which reads the
+ *     oldest one and releases it when it is done.
+ *
+ * \warning The producer and the consumer can run concurrently (e.g. an ISR
+ *      and the main loop or two threads) but there must be only one of each.
+ */
+#ifndef ARENA_ALLOCATOR_RING_API_H
+#define ARENA_ALLOCATOR_RING_API_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "arena-allocator-ring.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*!
+ * \brief Initialize the ring arena allocator handler over a caller supplied
+ *      buffer.
+ * \details The biggest aligned part of the buffer whose size is a power of
+ *      two is used by the ring.
+ *
+ * \attention This function should be called before the handler is shared
+ *      between the producer and the consumer.
+ *
+ * \param[in] hring  A reference to the ring arena allocator handler.
+ * \param[in] buffer A reference to the memory used by the ring, it must outlive the ring.
+ * \param[in] size   The size of the buffer in **bytes**.
+ * \return True on success, false if the buffer is too small.
+ */
+bool arena_allocator_ring_api_init(struct ArenaAllocatorRingHandler *hring, void *buffer, size_t size);
+
+/*!
+ * \brief Allocate a record at the head of the ring, called by the producer.
+ * \details The record is not visible to the consumer until it is committed.
+ *      The returned memory is aligned to \ref ARENA_ALLOCATOR_ALIGNMENT.
+ *
+ * \note Records are never split by the end of the buffer, so a record bigger
+ *      than half of the ring may not fit even when the ring is empty.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hring A reference to the ring arena allocator handler.
+ * \param[in] size  The size of the record in **bytes**.
+ * \return A pointer to the allocated record or NULL if the ring is full.
+ */
+void *arena_allocator_ring_api_alloc(struct ArenaAllocatorRingHandler *hring, size_t size);
+
+/*!
+ * \brief Make all the records allocated so far visible to the consumer,
+ *      called by the producer.
+ *
+ * \param[in] hring A reference to the ring arena allocator handler.
+ */
+void arena_allocator_ring_api_commit(struct ArenaAllocatorRingHandler *hring);
+
+/*!
+ * \brief Get the oldest committed record of the ring, called by the consumer.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hring A reference to the ring arena allocator handler.
+ * \param[out] size The reference where the size of the record in **bytes** is stored, can be NULL.
+ * \return A pointer to the record or NULL if the ring is empty.
+ */
+void *arena_allocator_ring_api_peek(struct ArenaAllocatorRingHandler *hring, size_t *size);
+
+/*!
+ * \brief Release the oldest committed record of the ring, called by the
+ *      consumer.
+ * \details The space of the record can be reused by the producer, any
+ *      reference to the record becomes invalid.
+ *
+ * \param[in] hring A reference to the ring arena allocator handler.
+ * \return True if a record was released, false if the ring is empty.
+ */
+bool arena_allocator_ring_api_release(struct ArenaAllocatorRingHandler *hring);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // ARENA_ALLOCATOR_RING_API_H
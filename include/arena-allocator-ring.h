@@ -0,0 +1,68 @@
+/*!
+ * \file arena-allocator-ring.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Lock-free ring arena for a single producer and a single consumer.
+ * \details The ring arena allocates records of variable size over a caller
+ *     supplied buffer: the producer carves them at the head by bumping an
+ *     offset and the consumer releases them from the tail in the same order,
+ *     so that messages are passed between them without copies, locks or
+ *     heap allocations.
+ *     A record which does not fit before the end of the buffer is placed at
+ *     its start and the space left at the end is skipped.
+ *
+ * \warning The producer and the consumer can run concurrently (e.g. an ISR
+ *      and the main loop or two threads) but there must be only one of each.
+ */
+#ifndef ARENA_ALLOCATOR_RING_H
+#define ARENA_ALLOCATOR_RING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+#include <atomic>
+#elif !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#endif // __cplusplus
+
+#include "arena-allocator.h"
+
+/*!
+ * \brief Size in **bytes** of a cache line.
+ * \details The indices owned by the producer and by the consumer are kept
+ *      this far apart so that they never share a cache line.
+ *      Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_RING_CACHE_LINE
+#define ARENA_ALLOCATOR_RING_CACHE_LINE (64U)
+#endif // ARENA_ALLOCATOR_RING_CACHE_LINE
+
+/*!
+ * \brief Header placed before every record of the ring.
+ */
+struct ArenaAllocatorRingRecord {
+    size_t size;   /*!< The space taken by the record in **bytes**, header and padding included. */
+    size_t length; /*!< The size requested for the record in **bytes**, zero for the space skipped at the end of the buffer. */
+};
+
+#if defined(__cplusplus) || !defined(__STDC_NO_ATOMICS__)
+
+/*!
+ * \brief Handler structure of the ring arena allocator.
+ * \details Positions are counted in **bytes** since the initialization and
+ *      wrap around the buffer, whose capacity is a power of two.
+ */
+struct ArenaAllocatorRingHandler {
+    uint8_t *buffer;                                  /*!< The start of the memory of the ring. */
+    size_t capacity;                                  /*!< The size of the memory of the ring in **bytes**. */
+    size_t reserved;                                  /*!< The position after the last record allocated by the producer, owned by the producer. */
+    ARENA_ALLOCATOR_ATOMIC(size_t) head;              /*!< The position after the last record committed by the producer. */
+    uint8_t padding[ARENA_ALLOCATOR_RING_CACHE_LINE]; /*!< Keeps the head and the tail on different cache lines. */
+    ARENA_ALLOCATOR_ATOMIC(size_t) tail;              /*!< The position of the oldest record not released by the consumer. */
+};
+
+#endif // __STDC_NO_ATOMICS__
+
+#endif // ARENA_ALLOCATOR_RING_H
@@ -0,0 +1,127 @@
+/*!
+ * \file arena-allocator-snapshot-api.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Snapshot of the content of an arena allocator.
+ * \details The used part of every block of an arena is written to a file as
+ *     a single contiguous image which can later be mapped read-only, without
+ *     any parsing, by any number of processes.
+ *     Items inside the image refer to each other through offsets instead of
+ *     pointers so that the image can be mapped at any address: while the
+ *     structures are built inside the arena every reference is stored as the
+ *     offset returned by \ref arena_allocator_snapshot_api_offset, after the
+ *     snapshot is loaded the offsets are turned back into pointers by
+ *     \ref arena_allocator_snapshot_api_resolve.
+ *
+ *     Arenas which support offsets (e.g. the ones initialized over a caller
+ *     supplied buffer) can store the offsets returned by
+ *     \ref arena_allocator_api_alloc_offset instead, which are turned into
+ *     pointers by \ref arena_allocator_snapshot_api_resolve_handle.
+ *
+ * \warning The offsets of the items are valid only until the arena is reset,
+ *      rewound or freed.
+ */
+#ifndef ARENA_ALLOCATOR_SNAPSHOT_API_H
+#define ARENA_ALLOCATOR_SNAPSHOT_API_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena-allocator.h"
+#include "arena-allocator-snapshot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/*!
+ * \brief Get the offset of an item inside the snapshot of an arena.
+ * \details The offset does not change when more items are allocated, so it
+ *      can be stored inside other items of the same arena in place of a
+ *      pointer.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] item   A reference to the item or to any byte inside it.
+ * \return The offset of the item or zero if the item is NULL or it does not
+ *      belong to the arena.
+ */
+size_t arena_allocator_snapshot_api_offset(const struct ArenaAllocatorHandler *harena, const void *item);
+
+/*!
+ * \brief Write the content of an arena to a file.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] root   A reference to the item from which the structures stored in the arena are reached, can be NULL.
+ * \param[in] path   The path of the file, it is overwritten if it exists.
+ * \return True on success, false if the file can't be written or the root
+ *      item does not belong to the arena.
+ */
+bool arena_allocator_snapshot_api_save(const struct ArenaAllocatorHandler *harena, const void *root, const char *path);
+
+/*!
+ * \brief Load a snapshot previously written to a file.
+ * \details On POSIX systems the file is mapped read-only and shared, so that
+ *      its pages are loaded lazily and shared through the page cache,
+ *      otherwise it is read into memory allocated from the heap.
+ *
+ * \param[in] hsnapshot A reference to the snapshot handler.
+ * \param[in] path      The path of the file.
+ * \return True on success, false if the file can't be read or it is not a
+ *      valid snapshot.
+ */
+bool arena_allocator_snapshot_api_load(struct ArenaAllocatorSnapshotHandler *hsnapshot, const char *path);
+
+/*!
+ * \brief Get the root item of a loaded snapshot.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hsnapshot A reference to the snapshot handler.
+ * \return A reference to the root item or NULL if none was saved.
+ */
+const void *arena_allocator_snapshot_api_root(const struct ArenaAllocatorSnapshotHandler *hsnapshot);
+
+/*!
+ * \brief Turn an offset stored inside a snapshot back into a pointer.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hsnapshot A reference to the snapshot handler.
+ * \param[in] offset    The offset of the item.
+ * \return A reference to the item or NULL if the offset is zero or outside
+ *      of the snapshot.
+ */
+const void *arena_allocator_snapshot_api_resolve(const struct ArenaAllocatorSnapshotHandler *hsnapshot, size_t offset);
+
+/*!
+ * \brief Turn an offset returned by the arena allocator and stored inside a
+ *      snapshot back into a pointer.
+ * \details The offsets of \ref arena_allocator_api_alloc_offset are counted
+ *      from the first block of the arena, while the ones of
+ *      \ref arena_allocator_snapshot_api_offset are counted from the start of
+ *      the file, so the two kinds can't be mixed.
+ *
+ * \attention The returned reference should be casted to the appropriate type.
+ *
+ * \param[in] hsnapshot A reference to the snapshot handler.
+ * \param[in] offset    The offset of the item returned by \ref arena_allocator_api_alloc_offset.
+ * \return A reference to the item or NULL if the offset is zero or outside
+ *      of the snapshot.
+ */
+const void *arena_allocator_snapshot_api_resolve_handle(const struct ArenaAllocatorSnapshotHandler *hsnapshot, uint32_t offset);
+
+/*!
+ * \brief Release a loaded snapshot.
+ * \details Every reference to the items of the snapshot becomes invalid.
+ *
+ * \param[in] hsnapshot A reference to the snapshot handler.
+ */
+void arena_allocator_snapshot_api_unload(struct ArenaAllocatorSnapshotHandler *hsnapshot);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif // ARENA_ALLOCATOR_SNAPSHOT_API_H
@@ -0,0 +1,66 @@
+/*!
+ * \file arena-allocator-snapshot.h
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Snapshot of the content of an arena allocator.
+ * \details The used part of every block of an arena is written to a file as
+ *     a single contiguous image which can later be mapped read-only, without
+ *     any parsing, by any number of processes.
+ *     Items inside the image refer to each other through offsets instead of
+ *     pointers so that the image can be mapped at any address.
+ */
+#ifndef ARENA_ALLOCATOR_SNAPSHOT_H
+#define ARENA_ALLOCATOR_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * \brief Magic number identifying a snapshot file ("ARNS").
+ */
+#define ARENA_ALLOCATOR_SNAPSHOT_MAGIC (0x534E5241U)
+
+/*!
+ * \brief Version of the snapshot file format.
+ */
+#define ARENA_ALLOCATOR_SNAPSHOT_VERSION (2U)
+
+/*!
+ * \brief Alignment in **bytes** of the items which is preserved inside a
+ *      snapshot.
+ * \details Every block is placed inside the image at an offset with the same
+ *      remainder as its address, items aligned to a bigger value may lose
+ *      their alignment. Must be a power of two not bigger than the page size.
+ *      Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT
+#define ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT (64U)
+#endif // ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT
+
+/*!
+ * \brief Header stored at the start of a snapshot file.
+ * \details The image of the arena follows the header, offsets are counted
+ *      from the start of the file so that zero is never a valid offset.
+ */
+struct ArenaAllocatorSnapshotHeader {
+    uint32_t magic;   /*!< Must be \ref ARENA_ALLOCATOR_SNAPSHOT_MAGIC. */
+    uint32_t version; /*!< Must be \ref ARENA_ALLOCATOR_SNAPSHOT_VERSION. */
+    uint64_t size;    /*!< The size of the whole file in **bytes**. */
+    uint64_t root;    /*!< The offset of the root item, zero if none. */
+    uint64_t first;   /*!< The offset of the first block, zero if the arena is empty. */
+};
+
+/*!
+ * \brief Handler structure of a loaded snapshot.
+ */
+struct ArenaAllocatorSnapshotHandler {
+    const void *base; /*!< A reference to the start of the loaded file. */
+    size_t size;      /*!< The size of the loaded file in **bytes**. */
+    size_t root;      /*!< The offset of the root item, zero if none. */
+    size_t first;     /*!< The offset of the first block, zero if the arena is empty. */
+    bool mapped;      /*!< True if the file is mapped, false if it was read into the heap. */
+};
+
+#endif // ARENA_ALLOCATOR_SNAPSHOT_H
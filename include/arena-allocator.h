@@ -9,9 +9,11 @@
  *     efficiently.
  *     This method allows for faster allocation and deallocation since all
  *     memory can be freed at once when the arena is no longer needed.
- *     This implementation of the allocator uses a dynamic array which gets
- *     reallocated when more memory is needed to keep track of all the
- *     allocated memory.
+ *     This implementation of the allocator carves the items out of large
+ *     memory blocks by simply advancing an offset (bump allocation); a new
+ *     block is requested only when the current one is exhausted and all the
+ *     blocks are tracked by a dynamic array which gets reallocated when more
+ *     blocks are needed.
  *
  * \warning Memory handled by the arena allocator should not be freed outside
  *      of the allocator itself.
@@ -21,29 +23,285 @@
 #ifndef ARENA_ALLOCATOR_H
 #define ARENA_ALLOCATOR_H
 
+#include <stdbool.h>
 #include <stddef.h>
 
 /*!
- * \brief Single item allocated inside the arena.
- * \details Can be any type (even arrays or structures), the actual type of the
- *      item depends on the user and is not tracked by the allocator itself.
+ * \brief Minimum size in **bytes** of every memory block requested by the
+ *      arena.
+ * \details Allocations bigger than this value get a dedicated block of the
+ *      exact requested size.
+ *      Can be overridden at compile time to better fit the target memory.
+ */
+#ifndef ARENA_ALLOCATOR_BLOCK_SIZE
+#define ARENA_ALLOCATOR_BLOCK_SIZE (4096U)
+#endif // ARENA_ALLOCATOR_BLOCK_SIZE
+
+/*!
+ * \brief Number of blocks tracked by every chunk of the list used when the
+ *      arena is configured with \ref ARENA_ALLOCATOR_TRACKING_CHUNKED.
+ * \details Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_ITEM_CHUNK_SIZE
+#define ARENA_ALLOCATOR_ITEM_CHUNK_SIZE (16U)
+#endif // ARENA_ALLOCATOR_ITEM_CHUNK_SIZE
+
+/*!
+ * \brief Minimum size in **bytes** of every memory block of child arenas
+ *      (\ref ARENA_ALLOCATOR_BACKEND_CHILD).
+ * \details Smaller than \ref ARENA_ALLOCATOR_BLOCK_SIZE so that many blocks
+ *      fit inside a single block of the parent.
+ *      Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_CHILD_BLOCK_SIZE
+#define ARENA_ALLOCATOR_CHILD_BLOCK_SIZE (1024U)
+#endif // ARENA_ALLOCATOR_CHILD_BLOCK_SIZE
+
+/*!
+ * \brief Granularity in **bytes** used to commit the memory of arenas
+ *      backed by virtual memory (\ref ARENA_ALLOCATOR_BACKEND_VM).
+ * \details Can be overridden at compile time, it must be a multiple of the
+ *      page size.
+ */
+#ifndef ARENA_ALLOCATOR_VM_COMMIT_SIZE
+#define ARENA_ALLOCATOR_VM_COMMIT_SIZE (2097152U)
+#endif // ARENA_ALLOCATOR_VM_COMMIT_SIZE
+
+/*!
+ * \brief Number of call sites whose allocations are traced separately when
+ *      the library is compiled with the ARENA_ALLOCATOR_TRACE macro defined.
+ * \details The allocations of the sites which do not fit are accounted
+ *      together in the last entry.
+ *      Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_TRACE_SITES
+#define ARENA_ALLOCATOR_TRACE_SITES (64U)
+#endif // ARENA_ALLOCATOR_TRACE_SITES
+
+/*!
+ * \brief Number of guard bytes placed before and after every item when the
+ *      library is compiled with the ARENA_ALLOCATOR_DEBUG macro defined.
+ * \details Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_DEBUG_GUARD_SIZE
+#define ARENA_ALLOCATOR_DEBUG_GUARD_SIZE (16U)
+#endif // ARENA_ALLOCATOR_DEBUG_GUARD_SIZE
+
+/*!
+ * \brief Value of the guard bytes placed around every item in debug mode.
+ * \details Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_DEBUG_GUARD_BYTE
+#define ARENA_ALLOCATOR_DEBUG_GUARD_BYTE (0xABU)
+#endif // ARENA_ALLOCATOR_DEBUG_GUARD_BYTE
+
+/*!
+ * \brief Value written over the items released by a rewind or a reset in
+ *      debug mode.
+ * \details Can be overridden at compile time.
+ */
+#ifndef ARENA_ALLOCATOR_DEBUG_POISON_BYTE
+#define ARENA_ALLOCATOR_DEBUG_POISON_BYTE (0xDDU)
+#endif // ARENA_ALLOCATOR_DEBUG_POISON_BYTE
+
+/*!
+ * \brief Alignment in **bytes** of a type, usable from both C and C++.
+ *
+ * \param[in] T The type.
+ */
+#ifdef __cplusplus
+#define ARENA_ALLOCATOR_ALIGNOF(T) alignof(T)
+#else
+#define ARENA_ALLOCATOR_ALIGNOF(T) _Alignof(T)
+#endif // __cplusplus
+
+/*!
+ * \brief Atomic object of a type, usable from both C and C++.
+ * \details On GCC and Clang std::atomic has the same size and representation
+ *      of the C11 atomic types, so that the structures of the thread safe
+ *      allocators can be shared between C and C++ code.
  *
- * \note The memory allocated for the actual item data is not contained inside
- *      the allocator, only a reference is kept.
+ * \param[in] T The type.
+ */
+#ifdef __cplusplus
+#define ARENA_ALLOCATOR_ATOMIC(T) std::atomic<T>
+#else
+#define ARENA_ALLOCATOR_ATOMIC(T) _Atomic(T)
+#endif // __cplusplus
+
+/*!
+ * \brief Alignment in **bytes** of every item returned by the arena.
+ * \details Matches the alignment guaranteed by malloc so that any type can be
+ *      stored inside the allocated items.
+ */
+#define ARENA_ALLOCATOR_ALIGNMENT (ARENA_ALLOCATOR_ALIGNOF(max_align_t))
+
+/*!
+ * \brief Source of the memory blocks used by the arena.
+ */
+enum ArenaAllocatorBackend {
+    ARENA_ALLOCATOR_BACKEND_HEAP = 0, /*!< Blocks are requested to the system heap when needed. */
+    ARENA_ALLOCATOR_BACKEND_STATIC,   /*!< A single caller supplied buffer is used, the heap is never touched. */
+    ARENA_ALLOCATOR_BACKEND_VM,       /*!< A single range of virtual memory is reserved once and committed while the arena grows (Linux only). */
+    ARENA_ALLOCATOR_BACKEND_CHILD,    /*!< Blocks are carved out of a parent arena and given back to it when possible. */
+};
+
+/*!
+ * \brief Structure used to keep track of the memory blocks of the arena.
+ */
+enum ArenaAllocatorTracking {
+    ARENA_ALLOCATOR_TRACKING_ARRAY = 0, /*!< A dynamic array reallocated according to the growth policy. */
+    ARENA_ALLOCATOR_TRACKING_CHUNKED,   /*!< A list of fixed size chunks, tracked blocks are never moved. */
+};
+
+/*!
+ * \brief Kind of pages backing the memory of arenas backed by virtual
+ *      memory (\ref ARENA_ALLOCATOR_BACKEND_VM).
+ */
+enum ArenaAllocatorPages {
+    ARENA_ALLOCATOR_PAGES_DEFAULT = 0,      /*!< Regular pages as chosen by the system. */
+    ARENA_ALLOCATOR_PAGES_TRANSPARENT_HUGE, /*!< Transparent huge pages are requested (best effort, MADV_HUGEPAGE). */
+    ARENA_ALLOCATOR_PAGES_HUGETLB,          /*!< Huge pages are taken from the reserved pool (MAP_HUGETLB), fails if not available. */
+};
+
+/*!
+ * \brief Configuration of the arena allocator.
+ * \details Every field left to 0 uses its default value.
+ */
+struct ArenaAllocatorConfig {
+    size_t initial_capacity;              /*!< The capacity of the array of blocks when first allocated (default 1). */
+    size_t growth_factor;                 /*!< The factor multiplying the capacity of the array when it is full (default 2). */
+    size_t growth_increment;              /*!< A fixed amount of blocks added to the capacity of the array when it is full, overrides the growth factor. */
+    size_t max_capacity;                  /*!< The maximum capacity of the array (default unlimited). */
+    size_t block_size;                    /*!< The minimum size of every memory block in **bytes** (default \ref ARENA_ALLOCATOR_BLOCK_SIZE). */
+    enum ArenaAllocatorTracking tracking; /*!< The structure used to keep track of the blocks, the growth policy is ignored for chunks. */
+    enum ArenaAllocatorPages pages;       /*!< The kind of pages backing the memory, used only by arenas backed by virtual memory. */
+    bool numa_bind;                       /*!< True to bind the memory to a NUMA node, used only by arenas backed by virtual memory. */
+    unsigned int numa_node;               /*!< The NUMA node the memory is bound to if numa_bind is true. */
+};
+
+/*!
+ * \brief Usage statistics of the arena allocator.
+ * \details Statistics are collected only if the library is compiled with the
+ *      ARENA_ALLOCATOR_STATS macro defined (which must be defined for every
+ *      file including the library headers as well).
+ */
+struct ArenaAllocatorStats {
+    size_t requested; /*!< The amount of **bytes** requested by the items currently allocated. */
+    size_t used;      /*!< The amount of **bytes** of the blocks used by the items currently allocated, alignment padding included. */
+    size_t reserved;  /*!< The amount of **bytes** of all the blocks owned by the arena. */
+    size_t overhead;  /*!< The amount of **bytes** used by the arena on top of the requested ones (padding and tracking of the blocks). */
+    size_t peak;      /*!< The highest amount of **bytes** ever used by the items at the same time. */
+    size_t growths;   /*!< The number of times the structure tracking the blocks has grown. */
+    size_t blocks;    /*!< The number of blocks allocated by the arena. */
+};
+
+/*!
+ * \brief Allocations made from a single call site of the arena allocator.
+ * \details Call sites are traced only if the library is compiled with the
+ *      ARENA_ALLOCATOR_TRACE macro defined (which must be defined for every
+ *      file including the library headers as well).
+ */
+struct ArenaAllocatorTraceSite {
+    const char *file;  /*!< The source file of the call site, NULL for an unused entry and for the last one. */
+    unsigned int line; /*!< The line of the call site. */
+    size_t count;      /*!< The number of allocation calls made from the call site, a batch counts once. */
+    size_t bytes;      /*!< The amount of **bytes** requested from the call site. */
+};
+
+/*!
+ * \brief Single memory block owned by the arena.
+ * \details Items of any type (even arrays or structures) are carved out of
+ *      the block one after the other, the actual type of each item depends on
+ *      the user and is not tracked by the allocator itself.
  */
 struct ArenaAllocatorItem {
-    void *value; /*!< A pointer to the allocated memory of the item. */
+    void *value; /*!< A pointer to the allocated memory of the block. */
+    size_t size; /*!< The size of the block in **bytes**. */
+    size_t used; /*!< The amount of **bytes** used in the block, up to date once the arena moved to the following block. */
+};
+
+#ifdef ARENA_ALLOCATOR_DEBUG
+/*!
+ * \brief Description of an item stored right before its leading guard bytes
+ *      in debug mode.
+ */
+struct ArenaAllocatorDebugHeader {
+    size_t start; /*!< The offset of the item inside the block. */
+    size_t size;  /*!< The size of the item in **bytes**. */
+};
+#endif // ARENA_ALLOCATOR_DEBUG
+
+/*!
+ * \brief Fixed size chunk of the list used to keep track of the memory blocks.
+ */
+struct ArenaAllocatorItemChunk {
+    struct ArenaAllocatorItemChunk *next;                             /*!< The following chunk of the list. */
+    struct ArenaAllocatorItem items[ARENA_ALLOCATOR_ITEM_CHUNK_SIZE]; /*!< The blocks tracked by the chunk. */
+};
+
+/*!
+ * \brief Cleanup callback registered for an item of the arena.
+ * \details Records are allocated inside the arena itself and linked from the
+ *      most recent one, so that callbacks run in reverse order of
+ *      registration.
+ */
+struct ArenaAllocatorDtor {
+    struct ArenaAllocatorDtor *prev; /*!< The callback registered before this one. */
+    void (*dtor)(void *item);        /*!< The function called when the item is released. */
+    void *item;                      /*!< The item passed to the callback. */
+};
+
+/*!
+ * \brief Save point of the arena allocator.
+ * \details Captures the state of the arena at a given moment so that all the
+ *      items allocated afterwards can be released at once.
+ */
+struct ArenaAllocatorMark {
+    size_t size;                      /*!< The number of blocks of the arena when the mark was taken. */
+    size_t offset;                    /*!< The amount of **bytes** used in the last block when the mark was taken. */
+    struct ArenaAllocatorItem *block; /*!< The last block when the mark was taken, used only when the blocks are tracked by chunks. */
+    struct ArenaAllocatorDtor *dtors; /*!< The last cleanup callback registered when the mark was taken. */
+#ifdef ARENA_ALLOCATOR_STATS
+    size_t requested; /*!< The amount of **bytes** requested when the mark was taken. */
+    size_t used;      /*!< The amount of **bytes** used when the mark was taken. */
+#endif // ARENA_ALLOCATOR_STATS
 };
 
 /*!
  * \brief Handler structure of the arena allocator.
  * \details The handler contains all the information used to manage a dynamic
- *      array where the items are stored.
+ *      array where the memory blocks are stored.
+ *      Items are always allocated from the last used block of the array,
+ *      blocks released by a rewind or a reset are kept after the used ones.
  */
 struct ArenaAllocatorHandler {
-    size_t size;                      /*!< The total number of items currently stored inside the arena. */
-    size_t capacity;                  /*!< The maximum amount of items which can be stored inside the arena. */
-    struct ArenaAllocatorItem *items; /*!< A pointer to the allocated array where all the arena items are stored. */
+    size_t size;                            /*!< The total number of blocks currently used by the arena. */
+    size_t capacity;                        /*!< The maximum amount of blocks which can be stored inside the arena. */
+    struct ArenaAllocatorItem *items;       /*!< A pointer to the allocated array where all the arena blocks are stored. */
+    size_t offset;                          /*!< The amount of **bytes** already used in the last used block. */
+    enum ArenaAllocatorBackend backend;     /*!< The source of the memory blocks of the arena. */
+    size_t reserved;                        /*!< The total number of blocks owned by the arena, the ones after the first size blocks are unused and kept for reuse. */
+    size_t clean;                           /*!< The offset of the last used block from which the memory is known to be zeroed. */
+    struct ArenaAllocatorConfig config;     /*!< The configuration of the arena. */
+    struct ArenaAllocatorItem *current;     /*!< A reference to the last used block. */
+    struct ArenaAllocatorItemChunk *chunks; /*!< The first chunk of the list of blocks when tracked by chunks. */
+    struct ArenaAllocatorItemChunk *tail;   /*!< The last chunk of the list of blocks when tracked by chunks. */
+    struct ArenaAllocatorItemChunk *spare;  /*!< The chunk holding the slot following the reserved blocks when tracked by chunks, NULL if the list is full. */
+    size_t limit;                           /*!< The amount of **bytes** of virtual memory reserved for the block when backed by virtual memory. */
+    struct ArenaAllocatorHandler *parent;   /*!< The arena the blocks are carved from when the arena is a child. */
+    struct ArenaAllocatorMark origin;       /*!< The state of the parent when the child was initialized. */
+    void *top;                              /*!< The end of the last memory carved from the parent by the child. */
+    bool exclusive;                         /*!< True if nothing else was carved from the parent between the child allocations. */
+    struct ArenaAllocatorDtor *dtors;       /*!< The last cleanup callback registered, run when the items are released. */
+    bool debug;                             /*!< True if the library was compiled in debug mode, the inline fast path is then never taken. */
+#ifdef ARENA_ALLOCATOR_STATS
+    struct ArenaAllocatorStats stats; /*!< The usage statistics of the arena. */
+#endif // ARENA_ALLOCATOR_STATS
+#ifdef ARENA_ALLOCATOR_TRACE
+    struct ArenaAllocatorTraceSite trace[ARENA_ALLOCATOR_TRACE_SITES]; /*!< The allocations made by each call site. */
+    struct ArenaAllocatorTraceSite site;                               /*!< The call site of the allocation in progress, set by \ref arena_allocator_api_trace_at. */
+#endif // ARENA_ALLOCATOR_TRACE
 };
 
 #endif // ARENA_ALLOCATOR_H
@@ -0,0 +1,229 @@
+/*!
+ * \file arena-allocator.hpp
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief C++ wrapper of the arena allocator.
+ * \details The arena is exposed as a std::pmr::memory_resource which owns the
+ *     arena allocator handler, and as a stateful allocator usable by any
+ *     standard container. Containers built on top of an arena allocate their
+ *     memory by bumping an offset and release nothing until the arena itself
+ *     is reset or destroyed, which frees everything at once.
+ *
+ * \warning Containers using an arena must not outlive it and must not be used
+ *      after the arena is reset or rewound past their allocations.
+ */
+#ifndef ARENA_ALLOCATOR_HPP
+#define ARENA_ALLOCATOR_HPP
+
+#if __cplusplus < 201703L
+#error "The C++ wrapper of the arena allocator requires C++17"
+#endif // __cplusplus
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "arena-allocator-api.h"
+
+namespace arena_allocator {
+
+/*!
+ * \brief Arena allocator owning its handler and usable as a polymorphic
+ *      memory resource.
+ * \details The handler is initialized on construction and all the memory is
+ *      freed on destruction. The arena can be neither copied nor moved since
+ *      its handler can be referenced by allocators, containers and child
+ *      arenas.
+ */
+class Arena : public std::pmr::memory_resource {
+public:
+    /*!
+     * \brief Create an arena with the default configuration.
+     */
+    Arena() noexcept {
+        arena_allocator_api_init(&harena);
+    }
+
+    /*!
+     * \brief Create an arena with a custom configuration.
+     *
+     * \param[in] config The configuration of the arena.
+     */
+    explicit Arena(const ArenaAllocatorConfig &config) noexcept {
+        arena_allocator_api_init_with_config(&harena, &config);
+    }
+
+    /*!
+     * \brief Create an arena over a caller supplied buffer which never grows.
+     *
+     * \param[in] buffer A reference to the buffer, it must outlive the arena.
+     * \param[in] size   The size of the buffer in **bytes**.
+     */
+    Arena(void *buffer, std::size_t size) noexcept {
+        arena_allocator_api_init_static(&harena, buffer, size);
+    }
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    ~Arena() override {
+        arena_allocator_api_free(&harena);
+    }
+
+    /*!
+     * \brief Get the underlying arena allocator handler.
+     *
+     * \return A reference to the arena allocator handler.
+     */
+    ArenaAllocatorHandler *handle() noexcept {
+        return &harena;
+    }
+
+    /*!
+     * \brief Construct an object inside the arena.
+     * \details If the object is not trivially destructible its destructor is
+     *      registered as a cleanup callback and called when the arena is
+     *      reset, rewound past the object or destroyed.
+     *
+     * \param[in] args The arguments forwarded to the constructor.
+     * \return A pointer to the constructed object.
+     * \throw std::bad_alloc if the arena is out of memory.
+     */
+    template <typename T, typename... Args>
+    T *make(Args &&...args) {
+        T *object = ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            if (!arena_allocator_api_on_free(&harena, object, [](void *item) { static_cast<T *>(item)->~T(); })) {
+                object->~T();
+                throw std::bad_alloc();
+            }
+        }
+        return object;
+    }
+
+    /*!
+     * \brief Save the current position of the arena.
+     *
+     * \return The mark to pass to \ref rewind.
+     */
+    ArenaAllocatorMark mark() const noexcept {
+        return arena_allocator_api_mark(&harena);
+    }
+
+    /*!
+     * \brief Release all the memory allocated after a mark.
+     *
+     * \param[in] mark The mark previously returned by \ref mark.
+     */
+    void rewind(ArenaAllocatorMark mark) noexcept {
+        arena_allocator_api_rewind(&harena, mark);
+    }
+
+    /*!
+     * \brief Release all the memory keeping the blocks for later use.
+     */
+    void reset() noexcept {
+        arena_allocator_api_reset(&harena);
+    }
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+        /*! Zero sized requests must still return a unique pointer */
+        void *item = arena_allocator_api_alloc_aligned(&harena, bytes > 0U ? bytes : 1U, alignment);
+        if (item == nullptr) {
+            throw std::bad_alloc();
+        }
+        return item;
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) noexcept override {
+        /*! The memory is released at once by the arena */
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+        return this == &other;
+    }
+
+    ArenaAllocatorHandler harena; /*!< The arena allocator handler. */
+};
+
+/*!
+ * \brief Stateful allocator serving the items of a container from an arena.
+ * \details Deallocation does nothing, the memory is given back when the arena
+ *      is reset or destroyed. Two allocators are equal if they use the same
+ *      arena.
+ *
+ * \tparam T The type of the allocated items.
+ */
+template <typename T>
+class Allocator {
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /*!
+     * \brief Create an allocator using an arena.
+     *
+     * \param[in] arena The arena, it must outlive the allocator.
+     */
+    Allocator(Arena &arena) noexcept : harena(arena.handle()) {}
+
+    /*!
+     * \brief Create an allocator using an arena allocator handler.
+     *
+     * \param[in] harena A reference to an initialized arena allocator handler.
+     */
+    explicit Allocator(ArenaAllocatorHandler *harena) noexcept : harena(harena) {}
+
+    template <typename U>
+    Allocator(const Allocator<U> &other) noexcept : harena(other.handle()) {}
+
+    /*!
+     * \brief Allocate an array of items.
+     *
+     * \param[in] count The number of items.
+     * \return A pointer to the first item.
+     * \throw std::bad_alloc if the arena is out of memory or the size overflows.
+     */
+    T *allocate(std::size_t count) {
+        void *item = arena_allocator_api_alloc_array_inline(harena, sizeof(T), count > 0U ? count : 1U, alignof(T));
+        if (item == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(item);
+    }
+
+    void deallocate(T *, std::size_t) noexcept {
+        /*! The memory is released at once by the arena */
+    }
+
+    /*!
+     * \brief Get the arena allocator handler used by the allocator.
+     *
+     * \return A reference to the arena allocator handler.
+     */
+    ArenaAllocatorHandler *handle() const noexcept {
+        return harena;
+    }
+
+private:
+    ArenaAllocatorHandler *harena; /*!< The arena allocator handler. */
+};
+
+template <typename T, typename U>
+bool operator==(const Allocator<T> &lhs, const Allocator<U> &rhs) noexcept {
+    return lhs.handle() == rhs.handle();
+}
+
+template <typename T, typename U>
+bool operator!=(const Allocator<T> &lhs, const Allocator<U> &rhs) noexcept {
+    return lhs.handle() != rhs.handle();
+}
+
+} // namespace arena_allocator
+
+#endif // ARENA_ALLOCATOR_HPP
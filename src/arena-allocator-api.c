@@ -9,132 +9,1552 @@
  *     efficiently.
  *     This method allows for faster allocation and deallocation since all
  *     memory can be freed at once when the arena is no longer needed.
- *     This implementation of the allocator uses a dynamic array which gets
- *     reallocated when more memory is needed to keep track of all the
- *     allocated memory.
+ *     This implementation of the allocator carves the items out of large
+ *     memory blocks by simply advancing an offset (bump allocation); a new
+ *     block is requested only when the current one is exhausted and all the
+ *     blocks are tracked by a dynamic array which gets reallocated when more
+ *     blocks are needed.
  *
  * \warning Memory handled by the arena allocator should not be freed outside
  *      of the allocator itself.
  *      This might caused undefined behavior caused by double free of the same
  *      memory region.
  */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+/*! Needed by mmap flags, madvise and syscall with strict standard modes */
+#define _DEFAULT_SOURCE
+#endif // __linux__
+
 #include "arena-allocator.h"
 #include "arena-allocator-api.h"
 
+#ifdef ARENA_ALLOCATOR_TRACE
+/*! The allocation functions are defined with their own names */
+#undef arena_allocator_api_alloc
+#undef arena_allocator_api_alloc_aligned
+#undef arena_allocator_api_calloc
+#undef arena_allocator_api_calloc_aligned
+#undef arena_allocator_api_alloc_batch
+#undef arena_allocator_api_alloc_n
+#undef arena_allocator_api_alloc_offset
+#undef arena_allocator_api_alloc_offset_aligned
+#undef arena_allocator_api_realloc
+#undef arena_allocator_api_alloc_with_dtor
+#endif // ARENA_ALLOCATOR_TRACE
+
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*! NUMA memory policy binding the pages to a set of nodes (from linux/mempolicy.h) */
+#define PRV_ARENA_ALLOCATOR_API_MPOL_BIND (2)
+/*! Maximum number of NUMA nodes supported by the binding */
+#define PRV_ARENA_ALLOCATOR_API_NUMA_NODES (1024U)
+#endif // __linux__
+
+#ifdef ARENA_ALLOCATOR_DEBUG
+#if defined(__SANITIZE_ADDRESS__)
+#define PRV_ARENA_ALLOCATOR_API_ASAN
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define PRV_ARENA_ALLOCATOR_API_ASAN
+#endif // __has_feature
+#endif // __SANITIZE_ADDRESS__
+
+/*! Mark the guard bytes and the released items as not accessible for ASan or Valgrind */
+#if defined(PRV_ARENA_ALLOCATOR_API_ASAN)
+#include <sanitizer/asan_interface.h>
+#define PRV_ARENA_ALLOCATOR_API_POISON(address, size)   ASAN_POISON_MEMORY_REGION((address), (size))
+#define PRV_ARENA_ALLOCATOR_API_UNPOISON(address, size) ASAN_UNPOISON_MEMORY_REGION((address), (size))
+#elif defined(__has_include)
+#if __has_include(<valgrind/memcheck.h>)
+#include <valgrind/memcheck.h>
+#define PRV_ARENA_ALLOCATOR_API_POISON(address, size)   ((void)VALGRIND_MAKE_MEM_NOACCESS((address), (size)))
+#define PRV_ARENA_ALLOCATOR_API_UNPOISON(address, size) ((void)VALGRIND_MAKE_MEM_UNDEFINED((address), (size)))
+#endif // __has_include
+#endif // PRV_ARENA_ALLOCATOR_API_ASAN
+
+/*! Called when the guard bytes of an item are found corrupted */
+#ifndef ARENA_ALLOCATOR_DEBUG_FAIL
+#define ARENA_ALLOCATOR_DEBUG_FAIL(harena) abort()
+#endif // ARENA_ALLOCATOR_DEBUG_FAIL
+
+/*! Worst case amount of **bytes** added to every item in debug mode */
+#define PRV_ARENA_ALLOCATOR_API_DEBUG_OVERHEAD \
+    (sizeof(struct ArenaAllocatorDebugHeader) + ARENA_ALLOCATOR_ALIGNMENT + 2U * ARENA_ALLOCATOR_DEBUG_GUARD_SIZE)
+#else
+#define PRV_ARENA_ALLOCATOR_API_DEBUG_OVERHEAD (0U)
+#endif // ARENA_ALLOCATOR_DEBUG
+
+#ifndef PRV_ARENA_ALLOCATOR_API_POISON
+#define PRV_ARENA_ALLOCATOR_API_POISON(address, size)   ((void)(address), (void)(size))
+#define PRV_ARENA_ALLOCATOR_API_UNPOISON(address, size) ((void)(address), (void)(size))
+#endif // PRV_ARENA_ALLOCATOR_API_POISON
+
 /*!
- * \brief Creates a new item and adds it to the arena allocator array.
+ * \brief Round an offset or an address up to the next multiple of the given
+ *      alignment.
+ *
+ * \param[in] value The offset or address to align.
+ * \param[in] align The alignment, must be a power of two.
+ * \return The aligned value.
+ */
+static uintptr_t prv_arena_allocator_api_align(uintptr_t value, size_t align) {
+    return (value + align - 1U) & ~((uintptr_t)align - 1U);
+}
+
+/*!
+ * \brief Get a block of the arena from its index.
+ * \details When the blocks are tracked by a list of chunks the list is walked
+ *      from its start, so the complexity is linear in the number of chunks;
+ *      the allocation, rewind and reset paths never use it.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] index  The index of the block, must be less than the capacity.
+ * \return A reference to the block.
+ */
+static struct ArenaAllocatorItem *prv_arena_allocator_api_item_at(const struct ArenaAllocatorHandler *harena, size_t index) {
+    assert(harena != NULL);
+    assert(index < harena->capacity);
+
+    if (harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED) {
+        struct ArenaAllocatorItemChunk *chunk = harena->chunks;
+        for (size_t i = index / ARENA_ALLOCATOR_ITEM_CHUNK_SIZE; i > 0U; --i) {
+            chunk = chunk->next;
+        }
+        return &chunk->items[index % ARENA_ALLOCATOR_ITEM_CHUNK_SIZE];
+    }
+    return &harena->items[index];
+}
+
+/*!
+ * \brief Get the block following the given one in constant time.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] item   A reference to the block, NULL to get the first block.
+ * \param[in] index  The index of the given block.
+ * \return A reference to the following block.
+ */
+static struct ArenaAllocatorItem *prv_arena_allocator_api_item_next(const struct ArenaAllocatorHandler *harena, struct ArenaAllocatorItem *item, size_t index) {
+    assert(harena != NULL);
+
+    if (item == NULL) {
+        return prv_arena_allocator_api_item_at(harena, 0U);
+    }
+    if (harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED && index % ARENA_ALLOCATOR_ITEM_CHUNK_SIZE == ARENA_ALLOCATOR_ITEM_CHUNK_SIZE - 1U) {
+        /*! The block is the last one of its chunk, get the chunk from the block */
+        struct ArenaAllocatorItemChunk *chunk = (struct ArenaAllocatorItemChunk *)((char *)(item - (ARENA_ALLOCATOR_ITEM_CHUNK_SIZE - 1U)) - offsetof(struct ArenaAllocatorItemChunk, items));
+        return &chunk->next->items[0U];
+    }
+    return item + 1;
+}
+
+/*!
+ * \brief Get the address right after the last item allocated by an arena.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \return The address of the top of the arena or NULL if it is empty.
+ */
+static void *prv_arena_allocator_api_top(const struct ArenaAllocatorHandler *harena) {
+    assert(harena != NULL);
+
+    if (harena->current == NULL) {
+        return NULL;
+    }
+    return (uint8_t *)harena->current->value + harena->offset;
+}
+
+/*!
+ * \brief Allocate the memory of a block or of a chunk of the arena.
+ * \details Child arenas carve it from their parent, keeping track of whether
+ *      the parent was used by someone else in the meantime, every other arena
+ *      requests it to the heap.
+ *      Zeroed memory is requested with calloc which can avoid touching the
+ *      memory at all if it comes fresh from the operating system.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of the memory in **bytes**.
+ * \param[in] zeroed True if the memory should be zero initialized.
+ * \return A reference to the allocated memory or NULL on failure.
+ */
+static void *prv_arena_allocator_api_memory_alloc(struct ArenaAllocatorHandler *harena, size_t size, bool zeroed) {
+    assert(harena != NULL);
+
+    if (harena->backend != ARENA_ALLOCATOR_BACKEND_CHILD) {
+        return zeroed ? calloc(1U, size) : malloc(size);
+    }
+    struct ArenaAllocatorHandler *parent = harena->parent;
+    if (parent == NULL) {
+        return NULL;
+    }
+    if (prv_arena_allocator_api_top(parent) != harena->top) {
+        harena->exclusive = false;
+    }
+    void *memory = zeroed ? arena_allocator_api_calloc(parent, size, 1U) : arena_allocator_api_alloc(parent, size);
+    if (memory != NULL) {
+        harena->top = prv_arena_allocator_api_top(parent);
+    }
+    return memory;
+}
+
+/*!
+ * \brief Creates a new block and adds it to the arena allocator array.
  * \details Based on the assumption that there is free space in the arena
- *      allocator array, it allocates a new item saving its information on the
+ *      allocator array, it allocates a new block saving its information on the
  *      array itself.
+ *      The new block becomes the one used for the following allocations, if
+ *      unused blocks are kept by the arena the first of them is moved after
+ *      the new one.
  *
  * \param[in] harena A reference to the arena allocator handler.
- * \param[in] size   The size of the item to allocate in **bytes**.
- * \return A reference to the newly allocated item or NULL on failure.
+ * \param[in] size   The size of the block to allocate in **bytes**.
+ * \param[in] zeroed True if the block memory should be zero initialized.
+ * \return A reference to the newly allocated block or NULL on failure.
  */
-void *prv_arena_allocator_api_item_push(struct ArenaAllocatorHandler *harena, size_t size) {
+void *prv_arena_allocator_api_item_push(struct ArenaAllocatorHandler *harena, size_t size, bool zeroed) {
     assert(harena != NULL);
-    assert(harena->size < harena->capacity);
+    assert(harena->reserved < harena->capacity);
     assert(size > 0);
 
-    void *item = malloc(size);
+    void *item = prv_arena_allocator_api_memory_alloc(harena, size, zeroed);
     if (item == NULL) {
         return NULL;
     }
-    struct ArenaAllocatorItem *items = harena->items;
-    items[harena->size].value = item;
+    struct ArenaAllocatorItem *next = prv_arena_allocator_api_item_next(harena, harena->current, harena->size - 1U);
+    if (harena->size < harena->reserved) {
+        /*! The chunk holding the slot is not the tail when many were reserved at once */
+        struct ArenaAllocatorItem *last = harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED
+            ? &harena->spare->items[harena->reserved % ARENA_ALLOCATOR_ITEM_CHUNK_SIZE]
+            : &harena->items[harena->reserved];
+        *last = *next;
+    }
+    /*! The used part of the block left behind is kept for the snapshots */
+    if (harena->current != NULL) {
+        harena->current->used = harena->offset;
+    }
+    next->value = item;
+    next->size = size;
+    next->used = 0U;
+    harena->current = next;
+#ifdef ARENA_ALLOCATOR_STATS
+    harena->stats.reserved += size;
+    ++harena->stats.blocks;
+#endif // ARENA_ALLOCATOR_STATS
+    ++harena->reserved;
     ++harena->size;
+    if (harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED && harena->reserved % ARENA_ALLOCATOR_ITEM_CHUNK_SIZE == 0U) {
+        harena->spare = harena->spare->next;
+    }
+    harena->offset = 0U;
+    harena->clean = zeroed ? 0U : size;
     return item;
 }
 
 /*!
- * \brief Creates a new item and adds it to the arena allocator array
- *      reallocating it if necessary.
- * \details If the array is full (i.e. size == capacity) it is reallocated with
- *      double its current capacity and then the item is pushed into it.
+ * \brief Computes the next capacity of the arena allocator array according
+ *      to the growth policy of the arena.
  *
  * \param[in] harena A reference to the arena allocator handler.
- * \param[in] size   The size of the item to allocate in **bytes**.
- * \return A reference to the newly allocated item or NULL on failure.
+ * \return The next capacity of the array or 0 if it can't grow anymore.
  */
-void *prv_arena_allocator_api_item_push_with_alloc(struct ArenaAllocatorHandler *harena, size_t size) {
+static size_t prv_arena_allocator_api_next_capacity(const struct ArenaAllocatorHandler *harena) {
     assert(harena != NULL);
-    assert(size > 0);
 
+    const struct ArenaAllocatorConfig *config = &harena->config;
+    size_t capacity = 0U;
+    if (config->tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED) {
+        /*! Chunks are always added one at a time */
+        capacity = harena->capacity > SIZE_MAX - ARENA_ALLOCATOR_ITEM_CHUNK_SIZE ? SIZE_MAX : harena->capacity + ARENA_ALLOCATOR_ITEM_CHUNK_SIZE;
+        return config->max_capacity > 0U && capacity > config->max_capacity ? 0U : capacity;
+    }
     if (harena->capacity == 0U) {
         /*!
-         * If no memory is allocated for the array, it is allocated with a
-         * capacity of 1.
+         * If no memory is allocated for the array, it is allocated with the
+         * initial capacity (1 by default).
          */
-        struct ArenaAllocatorItem *items = (struct ArenaAllocatorItem *)malloc(sizeof(*items));
-        if (items == NULL) {
-            return NULL;
-        }
-        harena->items = items;
-        harena->capacity = 1U;
-    } else if (harena->size == harena->capacity) {
+        capacity = config->initial_capacity > 0U ? config->initial_capacity : 1U;
+    } else if (config->growth_increment > 0U) {
+        /*! Fixed increments bound the unused memory of the array */
+        capacity = harena->capacity > SIZE_MAX - config->growth_increment ? SIZE_MAX : harena->capacity + config->growth_increment;
+    } else {
         /*!
-         * Every other allocation doubles the size of the array to keep the
-         * complexity amortized constant O(1)
+         * Every other allocation multiplies the size of the array (doubles by
+         * default) to keep the complexity amortized constant O(1)
          *
          * For more info see:
          *  - https://cs.stackexchange.com/questions/9380/why-is-push-back-in-c-vectors-constant-amortized
          */
-        struct ArenaAllocatorItem *items = (struct ArenaAllocatorItem *)realloc(
-            harena->items,
-            harena->capacity * 2U * sizeof(*items));
-        if (items == NULL) {
+        const size_t factor = config->growth_factor > 1U ? config->growth_factor : 2U;
+        capacity = harena->capacity > SIZE_MAX / factor ? SIZE_MAX : harena->capacity * factor;
+    }
+    if (config->max_capacity > 0U && capacity > config->max_capacity) {
+        capacity = config->max_capacity;
+    }
+    return capacity > harena->capacity ? capacity : 0U;
+}
+
+/*!
+ * \brief Reallocates the arena allocator array with the given capacity.
+ * \details When the blocks are tracked by a list of chunks, new chunks are
+ *      appended to the list until the capacity is reached instead, so that
+ *      the blocks already tracked are never moved.
+ *
+ * \param[in] harena   A reference to the arena allocator handler.
+ * \param[in] capacity The new capacity of the array, must be greater than the current one.
+ * \return True on success, false otherwise.
+ */
+static bool prv_arena_allocator_api_items_resize(struct ArenaAllocatorHandler *harena, size_t capacity) {
+    assert(harena != NULL);
+    assert(capacity > harena->capacity);
+
+    if (harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED) {
+        while (harena->capacity < capacity) {
+            if (harena->capacity > SIZE_MAX - ARENA_ALLOCATOR_ITEM_CHUNK_SIZE) {
+                return false;
+            }
+            struct ArenaAllocatorItemChunk *chunk = (struct ArenaAllocatorItemChunk *)prv_arena_allocator_api_memory_alloc(harena, sizeof(*chunk), false);
+            if (chunk == NULL) {
+                return false;
+            }
+            chunk->next = NULL;
+            if (harena->tail == NULL) {
+                harena->chunks = chunk;
+            } else {
+                harena->tail->next = chunk;
+            }
+            harena->tail = chunk;
+            /*! The slot following the reserved blocks is the first of the new chunk */
+            if (harena->spare == NULL) {
+                harena->spare = chunk;
+            }
+            harena->capacity += ARENA_ALLOCATOR_ITEM_CHUNK_SIZE;
+#ifdef ARENA_ALLOCATOR_STATS
+            ++harena->stats.growths;
+#endif // ARENA_ALLOCATOR_STATS
+        }
+        return true;
+    }
+    if (capacity > SIZE_MAX / sizeof(struct ArenaAllocatorItem)) {
+        return false;
+    }
+    struct ArenaAllocatorItem *items = (struct ArenaAllocatorItem *)realloc(
+        harena->items,
+        capacity * sizeof(*items));
+    if (items == NULL) {
+        return false;
+    }
+    harena->items = items;
+    harena->capacity = capacity;
+#ifdef ARENA_ALLOCATOR_STATS
+    ++harena->stats.growths;
+#endif // ARENA_ALLOCATOR_STATS
+    /*! The array might have been moved */
+    if (harena->size > 0U) {
+        harena->current = &items[harena->size - 1U];
+    }
+    return true;
+}
+
+/*!
+ * \brief Creates a new block and adds it to the arena allocator array
+ *      reallocating it if necessary.
+ * \details If the array is full (i.e. reserved == capacity) it is reallocated
+ *      following the growth policy of the arena and then the block is pushed
+ *      into it.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of the block to allocate in **bytes**.
+ * \param[in] zeroed True if the block memory should be zero initialized.
+ * \return A reference to the newly allocated block or NULL on failure.
+ */
+void *prv_arena_allocator_api_item_push_with_alloc(struct ArenaAllocatorHandler *harena, size_t size, bool zeroed) {
+    assert(harena != NULL);
+    assert(size > 0);
+
+    /*! Caller supplied buffers and virtual memory ranges never get new blocks */
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_STATIC || harena->backend == ARENA_ALLOCATOR_BACKEND_VM) {
+        return NULL;
+    }
+    if (harena->reserved == harena->capacity) {
+        const size_t capacity = prv_arena_allocator_api_next_capacity(harena);
+        if (capacity == 0U || !prv_arena_allocator_api_items_resize(harena, capacity)) {
+            return NULL;
+        }
+    }
+    return prv_arena_allocator_api_item_push(harena, size, zeroed);
+}
+
+#ifdef ARENA_ALLOCATOR_DEBUG
+/*!
+ * \brief Write the header and the guard bytes of a newly carved item.
+ * \details The header and the guard bytes are then marked as not accessible
+ *      so that ASan or Valgrind report any access to them.
+ *
+ * \param[in] block  A reference to the block containing the item.
+ * \param[in] header The offset of the header of the item inside the block.
+ * \param[in] start  The offset of the item inside the block.
+ * \param[in] size   The size of the item in **bytes**.
+ */
+static void prv_arena_allocator_api_debug_guard(struct ArenaAllocatorItem *block, size_t header, size_t start, size_t size) {
+    assert(block != NULL);
+
+    uint8_t *base = (uint8_t *)block->value;
+    const struct ArenaAllocatorDebugHeader info = { .start = start, .size = size };
+    PRV_ARENA_ALLOCATOR_API_UNPOISON(base + header, start - header);
+    memcpy(base + header, &info, sizeof(info));
+    memset(base + header + sizeof(info), ARENA_ALLOCATOR_DEBUG_GUARD_BYTE, start - header - sizeof(info));
+    PRV_ARENA_ALLOCATOR_API_POISON(base + header, start - header);
+    PRV_ARENA_ALLOCATOR_API_UNPOISON(base + start + size, ARENA_ALLOCATOR_DEBUG_GUARD_SIZE);
+    memset(base + start + size, ARENA_ALLOCATOR_DEBUG_GUARD_BYTE, ARENA_ALLOCATOR_DEBUG_GUARD_SIZE);
+    PRV_ARENA_ALLOCATOR_API_POISON(base + start + size, ARENA_ALLOCATOR_DEBUG_GUARD_SIZE);
+    block->used = start + size + ARENA_ALLOCATOR_DEBUG_GUARD_SIZE;
+}
+
+/*!
+ * \brief Poison the items released by a rewind or a reset.
+ * \details The released memory is overwritten and marked as not accessible so
+ *      that any use after the release is noticed.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The number of blocks used after the release.
+ * \param[in] offset The amount of **bytes** used in the last block after the release.
+ */
+static void prv_arena_allocator_api_debug_release(struct ArenaAllocatorHandler *harena, size_t size, size_t offset) {
+    assert(harena != NULL);
+
+    if (harena->size == 0U) {
+        return;
+    }
+    const size_t first = size > 0U ? size - 1U : 0U;
+    struct ArenaAllocatorItem *item = prv_arena_allocator_api_item_at(harena, first);
+    for (size_t i = first; i < harena->size; ++i) {
+        if (i > first) {
+            item = prv_arena_allocator_api_item_next(harena, item, i - 1U);
+        }
+        const size_t from = i + 1U == size ? offset : 0U;
+        const size_t to = item == harena->current ? harena->offset : item->used;
+        if (to > from) {
+            PRV_ARENA_ALLOCATOR_API_UNPOISON((uint8_t *)item->value + from, to - from);
+            memset((uint8_t *)item->value + from, ARENA_ALLOCATOR_DEBUG_POISON_BYTE, to - from);
+            PRV_ARENA_ALLOCATOR_API_POISON((uint8_t *)item->value + from, to - from);
+        }
+        item->used = from;
+    }
+}
+
+/*!
+ * \brief Verify the guard bytes of all the items of a block.
+ *
+ * \param[in] block A reference to the block.
+ * \param[in] used  The amount of **bytes** used in the block.
+ * \return True if all the guard bytes are intact, false otherwise.
+ */
+static bool prv_arena_allocator_api_debug_check_block(const struct ArenaAllocatorItem *block, size_t used) {
+    assert(block != NULL);
+
+    const uintptr_t base = (uintptr_t)block->value;
+    size_t offset = 0U;
+    while (offset < used) {
+        const size_t header = (size_t)(prv_arena_allocator_api_align(base + offset, _Alignof(struct ArenaAllocatorDebugHeader)) - base);
+        if (header > used || sizeof(struct ArenaAllocatorDebugHeader) > used - header) {
+            return false;
+        }
+        struct ArenaAllocatorDebugHeader info;
+        PRV_ARENA_ALLOCATOR_API_UNPOISON((void *)(base + header), sizeof(info));
+        memcpy(&info, (void *)(base + header), sizeof(info));
+        PRV_ARENA_ALLOCATOR_API_POISON((void *)(base + header), sizeof(info));
+        if (info.start < header + sizeof(info) || info.start > used || info.size > used - info.start ||
+            ARENA_ALLOCATOR_DEBUG_GUARD_SIZE > used - info.start - info.size) {
+            return false;
+        }
+        const uint8_t *front = (const uint8_t *)(base + header + sizeof(info));
+        const uint8_t *back = (const uint8_t *)(base + info.start + info.size);
+        const size_t count = info.start - header - sizeof(info);
+        bool intact = true;
+        PRV_ARENA_ALLOCATOR_API_UNPOISON(front, count);
+        PRV_ARENA_ALLOCATOR_API_UNPOISON(back, ARENA_ALLOCATOR_DEBUG_GUARD_SIZE);
+        for (size_t i = 0U; i < count; ++i) {
+            intact = intact && front[i] == ARENA_ALLOCATOR_DEBUG_GUARD_BYTE;
+        }
+        for (size_t i = 0U; i < ARENA_ALLOCATOR_DEBUG_GUARD_SIZE; ++i) {
+            intact = intact && back[i] == ARENA_ALLOCATOR_DEBUG_GUARD_BYTE;
+        }
+        PRV_ARENA_ALLOCATOR_API_POISON(front, count);
+        PRV_ARENA_ALLOCATOR_API_POISON(back, ARENA_ALLOCATOR_DEBUG_GUARD_SIZE);
+        if (!intact) {
+            return false;
+        }
+        offset = info.start + info.size + ARENA_ALLOCATOR_DEBUG_GUARD_SIZE;
+    }
+    return true;
+}
+#endif // ARENA_ALLOCATOR_DEBUG
+
+/*!
+ * \brief Carves a new item out of the last block of the arena.
+ * \details The item is placed at the first address after the used part of the
+ *      block which satisfies the requested alignment.
+ *      If the item should be zeroed only the part of it which is not already
+ *      known to be zero is cleared.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of the item to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \param[in] zeroed True if the item memory should be zero initialized.
+ * \return A reference to the newly allocated item or NULL if it does not fit
+ *      inside the block.
+ */
+static void *prv_arena_allocator_api_block_carve(struct ArenaAllocatorHandler *harena, size_t size, size_t align, bool zeroed) {
+    assert(harena != NULL);
+    assert(harena->size > 0U);
+
+    struct ArenaAllocatorItem *block = harena->current;
+    const uintptr_t base = (uintptr_t)block->value;
+#ifdef ARENA_ALLOCATOR_DEBUG
+    /*! The item is preceded by its header and surrounded by guard bytes */
+    const size_t header = (size_t)(prv_arena_allocator_api_align(base + harena->offset, _Alignof(struct ArenaAllocatorDebugHeader)) - base);
+    if (header > block->size || sizeof(struct ArenaAllocatorDebugHeader) + ARENA_ALLOCATOR_DEBUG_GUARD_SIZE > block->size - header) {
+        return NULL;
+    }
+    const size_t start = (size_t)(prv_arena_allocator_api_align(base + header + sizeof(struct ArenaAllocatorDebugHeader) + ARENA_ALLOCATOR_DEBUG_GUARD_SIZE, align) - base);
+    if (start > block->size || size > block->size - start || ARENA_ALLOCATOR_DEBUG_GUARD_SIZE > block->size - start - size) {
+        return NULL;
+    }
+    const size_t end = start + size + ARENA_ALLOCATOR_DEBUG_GUARD_SIZE;
+    PRV_ARENA_ALLOCATOR_API_UNPOISON((void *)(base + start), size);
+#else
+    const size_t start = (size_t)(prv_arena_allocator_api_align(base + harena->offset, align) - base);
+    if (start > block->size || size > block->size - start) {
+        return NULL;
+    }
+    const size_t end = start + size;
+#endif // ARENA_ALLOCATOR_DEBUG
+    if (zeroed && start < harena->clean) {
+        memset((void *)(base + start), 0, (start + size < harena->clean ? start + size : harena->clean) - start);
+    }
+#ifdef ARENA_ALLOCATOR_DEBUG
+    prv_arena_allocator_api_debug_guard(block, header, start, size);
+#endif // ARENA_ALLOCATOR_DEBUG
+    if (end > harena->clean) {
+        harena->clean = end;
+    }
+#ifdef ARENA_ALLOCATOR_STATS
+    harena->stats.requested += size;
+    harena->stats.used += end - harena->offset;
+    if (harena->stats.used > harena->stats.peak) {
+        harena->stats.peak = harena->stats.used;
+    }
+#endif // ARENA_ALLOCATOR_STATS
+    harena->offset = end;
+    return (void *)(base + start);
+}
+
+#if defined(__linux__)
+/*!
+ * \brief Bind a range of virtual memory to a single NUMA node.
+ * \details The system call is used directly so that the library does not
+ *      depend on libnuma, the policy is applied to the pages when they are
+ *      first touched.
+ *
+ * \param[in] address The start of the range, must be page aligned.
+ * \param[in] size    The size of the range in **bytes**.
+ * \param[in] node    The NUMA node.
+ * \return True on success, false if the node does not exist or the system
+ *      does not support NUMA policies.
+ */
+static bool prv_arena_allocator_api_vm_bind(void *address, size_t size, unsigned int node) {
+    unsigned long mask[PRV_ARENA_ALLOCATOR_API_NUMA_NODES / (8U * sizeof(unsigned long))] = { 0 };
+    const size_t bits = 8U * sizeof(unsigned long);
+    if (node >= PRV_ARENA_ALLOCATOR_API_NUMA_NODES) {
+        return false;
+    }
+    mask[node / bits] = 1UL << (node % bits);
+    return syscall(SYS_mbind, address, size, PRV_ARENA_ALLOCATOR_API_MPOL_BIND, mask, (unsigned long)PRV_ARENA_ALLOCATOR_API_NUMA_NODES, 0U) == 0;
+}
+#endif // __linux__
+
+/*!
+ * \brief Commit enough virtual memory of the block of the arena to fit an
+ *      item.
+ * \details The memory is committed in steps of
+ *      \ref ARENA_ALLOCATOR_VM_COMMIT_SIZE **bytes**, the size of the block
+ *      is the amount of committed memory.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] start  The offset of the item inside the block.
+ * \param[in] size   The size of the item in **bytes**.
+ * \return True if the item fits inside the block, false if the arena is not
+ *      backed by virtual memory or the reserved range is exhausted.
+ */
+static bool prv_arena_allocator_api_vm_commit(struct ArenaAllocatorHandler *harena, size_t start, size_t size) {
+    assert(harena != NULL);
+
+#if defined(__linux__)
+    if (harena->backend != ARENA_ALLOCATOR_BACKEND_VM || harena->current == NULL) {
+        return false;
+    }
+    struct ArenaAllocatorItem *block = harena->current;
+    if (start > harena->limit || size > harena->limit - start) {
+        return false;
+    }
+    const size_t end = start + size;
+    if (end <= block->size) {
+        return true;
+    }
+    size_t committed = harena->limit;
+    if (harena->limit - end >= ARENA_ALLOCATOR_VM_COMMIT_SIZE) {
+        committed = (size_t)prv_arena_allocator_api_align(end, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    }
+    if (mprotect((uint8_t *)block->value + block->size, committed - block->size, PROT_READ | PROT_WRITE) != 0) {
+        return false;
+    }
+#ifdef ARENA_ALLOCATOR_STATS
+    harena->stats.reserved += committed - block->size;
+#endif // ARENA_ALLOCATOR_STATS
+    /*! Freshly committed pages are always zeroed */
+    block->size = committed;
+    return true;
+#else
+    (void)start;
+    (void)size;
+    return false;
+#endif // __linux__
+}
+
+/*!
+ * \brief Carves a new item out of the last block of the arena.
+ * \details The item is placed at the first suitably aligned address of the
+ *      last used block, if it does not fit the smallest block kept by the
+ *      arena which fits it is used or a new block is pushed into the arena and
+ *      the item is placed inside it.
+ *      The padding needed to satisfy the alignment is accounted inside the
+ *      block itself.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The size of the item to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \param[in] zeroed True if the item memory should be zero initialized.
+ * \return A reference to the newly allocated item or NULL on failure.
+ */
+void *prv_arena_allocator_api_bump(struct ArenaAllocatorHandler *harena, size_t size, size_t align, bool zeroed) {
+    assert(harena != NULL);
+    assert(size > 0);
+    assert(align > 0 && (align & (align - 1U)) == 0U);
+
+    if (harena->size > 0U) {
+        void *item = prv_arena_allocator_api_block_carve(harena, size, align, zeroed);
+        if (item != NULL) {
+            return item;
+        }
+    }
+    /*! The single block of a virtual memory range grows in place */
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_VM) {
+        if (harena->current == NULL) {
             return NULL;
         }
-        harena->items = items;
-        harena->capacity *= 2U;
+        const uintptr_t base = (uintptr_t)harena->current->value;
+        const size_t start = (size_t)(prv_arena_allocator_api_align(base + harena->offset, align) - base);
+        if (size > SIZE_MAX - PRV_ARENA_ALLOCATOR_API_DEBUG_OVERHEAD ||
+            !prv_arena_allocator_api_vm_commit(harena, start, size + PRV_ARENA_ALLOCATOR_API_DEBUG_OVERHEAD)) {
+            return NULL;
+        }
+        return prv_arena_allocator_api_block_carve(harena, size, align, zeroed);
+    }
+    /*!
+     * The current block is exhausted, items bigger than a block get their own
+     * with enough room for the worst case alignment padding
+     */
+    const size_t padding = (align > ARENA_ALLOCATOR_ALIGNMENT ? align - ARENA_ALLOCATOR_ALIGNMENT : 0U) + PRV_ARENA_ALLOCATOR_API_DEBUG_OVERHEAD;
+    if (size > SIZE_MAX - padding) {
+        return NULL;
+    }
+    /*!
+     * Reuse the smallest block kept by the arena which fits the item, it is
+     * swapped with the first kept one so that the used blocks stay in front
+     * and a loop repeating the same allocations stops requesting new blocks
+     */
+    if (harena->size < harena->reserved) {
+        struct ArenaAllocatorItem *current = harena->current;
+        const size_t offset = harena->offset;
+        const size_t clean = harena->clean;
+        struct ArenaAllocatorItem *next = prv_arena_allocator_api_item_next(harena, current, harena->size - 1U);
+        struct ArenaAllocatorItem *best = NULL;
+        struct ArenaAllocatorItem *block = next;
+        for (size_t i = harena->size; i < harena->reserved; ++i) {
+            if (block->size >= size + padding && (best == NULL || block->size < best->size)) {
+                best = block;
+            }
+            if (i + 1U < harena->reserved) {
+                block = prv_arena_allocator_api_item_next(harena, block, i);
+            }
+        }
+        if (best != NULL) {
+            const struct ArenaAllocatorItem kept = *best;
+            *best = *next;
+            *next = kept;
+            if (current != NULL) {
+                current->used = offset;
+            }
+            harena->current = next;
+            ++harena->size;
+            harena->offset = 0U;
+            harena->clean = next->size;
+            void *item = prv_arena_allocator_api_block_carve(harena, size, align, zeroed);
+            if (item != NULL) {
+                return item;
+            }
+            --harena->size;
+            harena->current = current;
+            harena->offset = offset;
+            harena->clean = clean;
+        }
+    }
+    const size_t min_block_size = harena->config.block_size > 0U ? harena->config.block_size : ARENA_ALLOCATOR_BLOCK_SIZE;
+    size_t block_size = size + padding > min_block_size ? size + padding : min_block_size;
+    /*!
+     * Kept blocks mean that the arena is reused by a loop, a block bigger
+     * than all of them is rounded up so that slightly bigger items of the
+     * following iterations fit inside it as well
+     */
+    if (harena->size < harena->reserved && block_size % min_block_size != 0U && block_size <= SIZE_MAX - min_block_size) {
+        block_size += min_block_size - block_size % min_block_size;
+    }
+    if (prv_arena_allocator_api_item_push_with_alloc(harena, block_size, zeroed) == NULL) {
+        return NULL;
+    }
+    return prv_arena_allocator_api_block_carve(harena, size, align, zeroed);
+}
+
+/*!
+ * \brief Run the cleanup callbacks registered after the given one.
+ * \details Callbacks are run from the most recent one, so that items are
+ *      cleaned up in the reverse order of registration.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] until  The last callback which should not be run or NULL to run all of them.
+ */
+static void prv_arena_allocator_api_dtors_run(struct ArenaAllocatorHandler *harena, struct ArenaAllocatorDtor *until) {
+    assert(harena != NULL);
+
+    while (harena->dtors != NULL && harena->dtors != until) {
+        struct ArenaAllocatorDtor *record = harena->dtors;
+        /*! The record is unlinked first in case the callback uses the arena */
+        harena->dtors = record->prev;
+        record->dtor(record->item);
     }
-    return prv_arena_allocator_api_item_push(harena, size);
+}
+
+/*!
+ * \brief Clear all the fields of the handler of an arena.
+ * \details In debug mode the handler records it, so that the inline fast path
+ *      compiled in files without the ARENA_ALLOCATOR_DEBUG macro defined never
+ *      carves items without their guard bytes.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ */
+static void prv_arena_allocator_api_clear(struct ArenaAllocatorHandler *harena) {
+    assert(harena != NULL);
+
+    memset(harena, 0, sizeof(*harena));
+#ifdef ARENA_ALLOCATOR_DEBUG
+    harena->debug = true;
+#endif // ARENA_ALLOCATOR_DEBUG
 }
 
 void arena_allocator_api_init(struct ArenaAllocatorHandler *harena) {
     if (harena == NULL) {
         return;
     }
-    memset(harena, 0, sizeof(*harena));
+    prv_arena_allocator_api_clear(harena);
+}
+
+void arena_allocator_api_init_with_config(struct ArenaAllocatorHandler *harena, const struct ArenaAllocatorConfig *config) {
+    if (harena == NULL) {
+        return;
+    }
+    prv_arena_allocator_api_clear(harena);
+    if (config != NULL) {
+        harena->config = *config;
+    }
+}
+
+bool arena_allocator_api_reserve(struct ArenaAllocatorHandler *harena, size_t capacity) {
+    if (harena == NULL) {
+        return false;
+    }
+    if (capacity <= harena->capacity) {
+        return true;
+    }
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_STATIC || harena->backend == ARENA_ALLOCATOR_BACKEND_VM ||
+        (harena->config.max_capacity > 0U && capacity > harena->config.max_capacity)) {
+        return false;
+    }
+    return prv_arena_allocator_api_items_resize(harena, capacity);
+}
+
+void arena_allocator_api_init_static(struct ArenaAllocatorHandler *harena, void *buffer, size_t size) {
+    if (harena == NULL) {
+        return;
+    }
+    prv_arena_allocator_api_clear(harena);
+    harena->backend = ARENA_ALLOCATOR_BACKEND_STATIC;
+    if (buffer == NULL) {
+        return;
+    }
+
+    /*!
+     * The array tracking the single block is stored at the start of the
+     * buffer itself, the rest of the buffer is the block
+     */
+    const uintptr_t begin = (uintptr_t)buffer;
+    const uintptr_t items = prv_arena_allocator_api_align(begin, _Alignof(struct ArenaAllocatorItem));
+    const uintptr_t block = prv_arena_allocator_api_align(items + sizeof(struct ArenaAllocatorItem), ARENA_ALLOCATOR_ALIGNMENT);
+    if (block < begin || block - begin >= size) {
+        return;
+    }
+    harena->items = (struct ArenaAllocatorItem *)items;
+    harena->items[0U].value = (void *)block;
+    harena->items[0U].size = size - (block - begin);
+    harena->items[0U].used = 0U;
+    harena->current = harena->items;
+    harena->size = 1U;
+    harena->capacity = 1U;
+    harena->reserved = 1U;
+#ifdef ARENA_ALLOCATOR_STATS
+    harena->stats.reserved = harena->items[0U].size;
+#endif // ARENA_ALLOCATOR_STATS
+    /*! The content of the buffer is unknown */
+    harena->clean = harena->items[0U].size;
+}
+
+bool arena_allocator_api_init_vm(struct ArenaAllocatorHandler *harena, size_t size) {
+    return arena_allocator_api_init_vm_with_config(harena, size, NULL);
+}
+
+bool arena_allocator_api_init_vm_with_config(struct ArenaAllocatorHandler *harena, size_t size, const struct ArenaAllocatorConfig *config) {
+    if (harena == NULL) {
+        return false;
+    }
+    prv_arena_allocator_api_clear(harena);
+    harena->backend = ARENA_ALLOCATOR_BACKEND_VM;
+    if (config != NULL) {
+        harena->config = *config;
+    }
+#if defined(__linux__)
+    const long page = sysconf(_SC_PAGESIZE);
+    if (size == 0U || page <= 0) {
+        return false;
+    }
+    /*! Huge pages are used only if the range is aligned to their size */
+    const bool huge = harena->config.pages != ARENA_ALLOCATOR_PAGES_DEFAULT;
+    const size_t align = huge ? ARENA_ALLOCATOR_VM_COMMIT_SIZE : (size_t)page;
+    if (size > SIZE_MAX - 2U * align) {
+        return false;
+    }
+    size = (size_t)prv_arena_allocator_api_align(size, align);
+
+    /*! The range is only reserved, the memory is committed by the allocations */
+    uint8_t *block = NULL;
+    if (harena->config.pages == ARENA_ALLOCATOR_PAGES_HUGETLB) {
+        /*! Huge pages are reserved from the pool upfront so that a fault never fails */
+        block = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (block == MAP_FAILED) {
+            return false;
+        }
+    } else {
+        /*! A bigger range is reserved and trimmed to get the needed alignment */
+        uint8_t *region = mmap(NULL, size + align - (size_t)page, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (region == MAP_FAILED) {
+            return false;
+        }
+        block = (uint8_t *)prv_arena_allocator_api_align((uintptr_t)region, align);
+        if (block > region) {
+            (void)munmap(region, (size_t)(block - region));
+        }
+        if ((size_t)(block - region) < align - (size_t)page) {
+            (void)munmap(block + size, align - (size_t)page - (size_t)(block - region));
+        }
+        if (harena->config.pages == ARENA_ALLOCATOR_PAGES_TRANSPARENT_HUGE) {
+            (void)madvise(block, size, MADV_HUGEPAGE);
+        }
+    }
+    if (harena->config.numa_bind && !prv_arena_allocator_api_vm_bind(block, size, harena->config.numa_node)) {
+        (void)munmap(block, size);
+        return false;
+    }
+
+    /*! The item tracking the single block is stored in its own page */
+    struct ArenaAllocatorItem *items = mmap(NULL, (size_t)page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (items == MAP_FAILED) {
+        (void)munmap(block, size);
+        return false;
+    }
+    harena->items = items;
+    harena->items[0U].value = block;
+    harena->items[0U].size = 0U;
+    harena->items[0U].used = 0U;
+    harena->current = harena->items;
+    harena->size = 1U;
+    harena->capacity = 1U;
+    harena->reserved = 1U;
+    harena->limit = size;
+    return true;
+#else
+    (void)size;
+    return false;
+#endif // __linux__
+}
+
+void arena_allocator_api_init_child(struct ArenaAllocatorHandler *harena, struct ArenaAllocatorHandler *parent) {
+    if (harena == NULL) {
+        return;
+    }
+    prv_arena_allocator_api_clear(harena);
+    harena->backend = ARENA_ALLOCATOR_BACKEND_CHILD;
+    /*! Chunks are carved from the parent as well, an array would be reallocated */
+    harena->config.tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED;
+    harena->config.block_size = ARENA_ALLOCATOR_CHILD_BLOCK_SIZE;
+    if (parent == NULL || parent == harena) {
+        return;
+    }
+    harena->parent = parent;
+    harena->origin = arena_allocator_api_mark(parent);
+    harena->top = prv_arena_allocator_api_top(parent);
+    harena->exclusive = true;
+}
+
+#ifdef ARENA_ALLOCATOR_TRACE
+/*!
+ * \brief Account an allocation to its call site.
+ * \details Call sites are matched by file and line, once every entry is used
+ *      the allocations of the new call sites are accounted to the last one.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] size   The amount of **bytes** requested by the allocation.
+ * \param[in] file   The source file of the call site.
+ * \param[in] line   The line of the call site.
+ */
+static void prv_arena_allocator_api_trace_record(struct ArenaAllocatorHandler *harena, size_t size, const char *file, unsigned int line) {
+    assert(harena != NULL);
+
+    if (file == NULL) {
+        file = "";
+    }
+    struct ArenaAllocatorTraceSite *site = &harena->trace[ARENA_ALLOCATOR_TRACE_SITES - 1U];
+    for (size_t i = 0U; i + 1U < ARENA_ALLOCATOR_TRACE_SITES; ++i) {
+        struct ArenaAllocatorTraceSite *entry = &harena->trace[i];
+        if (entry->file == NULL) {
+            entry->file = file;
+            entry->line = line;
+            site = entry;
+            break;
+        }
+        /*! The same file name may be stored at different addresses */
+        if (entry->line == line && (entry->file == file || strcmp(entry->file, file) == 0)) {
+            site = entry;
+            break;
+        }
+    }
+    ++site->count;
+    site->bytes += size;
+}
+
+#endif // ARENA_ALLOCATOR_TRACE
+
+/*!
+ * \brief Take the call site set by \ref arena_allocator_api_trace_at for the
+ *      allocation in progress.
+ * \details The call site is cleared so that it is never accounted twice.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \return The call site, its file is NULL if none was set or the allocations
+ *      are not traced.
+ */
+static struct ArenaAllocatorTraceSite prv_arena_allocator_api_trace_take(struct ArenaAllocatorHandler *harena) {
+    assert(harena != NULL);
+
+    struct ArenaAllocatorTraceSite site = { 0 };
+#ifdef ARENA_ALLOCATOR_TRACE
+    site = harena->site;
+    harena->site.file = NULL;
+#else
+    (void)harena;
+#endif // ARENA_ALLOCATOR_TRACE
+    return site;
+}
+
+/*!
+ * \brief Account the memory taken by an allocation to its call site.
+ *
+ * \param[in] harena A reference to the arena allocator handler.
+ * \param[in] site   A reference to the call site taken when the allocation started.
+ * \param[in] size   The amount of **bytes** requested by the allocation.
+ */
+static void prv_arena_allocator_api_trace_charge(struct ArenaAllocatorHandler *harena, const struct ArenaAllocatorTraceSite *site, size_t size) {
+    assert(harena != NULL);
+    assert(site != NULL);
+
+#ifdef ARENA_ALLOCATOR_TRACE
+    if (site->file != NULL && size > 0U) {
+        prv_arena_allocator_api_trace_record(harena, size, site->file, site->line);
+    }
+#else
+    (void)harena;
+    (void)site;
+    (void)size;
+#endif // ARENA_ALLOCATOR_TRACE
 }
 
 void *arena_allocator_api_alloc(struct ArenaAllocatorHandler *harena, size_t size) {
-    if (harena == NULL || size == 0U) {
+    return arena_allocator_api_alloc_aligned(harena, size, ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+void *arena_allocator_api_alloc_aligned(struct ArenaAllocatorHandler *harena, size_t size, size_t align) {
+    if (harena == NULL || size == 0U || align == 0U || (align & (align - 1U)) != 0U) {
         return NULL;
     }
-    return prv_arena_allocator_api_item_push_with_alloc(harena, size);
+    return prv_arena_allocator_api_bump(harena, size, align, false);
 }
 
 void *arena_allocator_api_calloc(struct ArenaAllocatorHandler *harena, size_t size, size_t count) {
+    return arena_allocator_api_calloc_aligned(harena, size, count, ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+void *arena_allocator_api_calloc_aligned(struct ArenaAllocatorHandler *harena, size_t size, size_t count, size_t align) {
+    if (harena == NULL || size == 0U || count == 0U || align == 0U || (align & (align - 1U)) != 0U) {
+        return NULL;
+    }
+    /*! The total size of the items should not overflow */
+    if (count > SIZE_MAX / size) {
+        return NULL;
+    }
+    return prv_arena_allocator_api_bump(harena, size * count, align, true);
+}
+
+bool arena_allocator_api_alloc_batch(struct ArenaAllocatorHandler *harena, const size_t *sizes, size_t count, void **items) {
+    if (harena == NULL || sizes == NULL || count == 0U || items == NULL) {
+        return false;
+    }
+    const struct ArenaAllocatorTraceSite site = prv_arena_allocator_api_trace_take(harena);
+    /*! Every item starts aligned, the total size should not overflow */
+    size_t total = 0U;
+    size_t requested = 0U;
+    for (size_t i = 0U; i < count; ++i) {
+        if (sizes[i] == 0U || sizes[i] > SIZE_MAX - ARENA_ALLOCATOR_ALIGNMENT) {
+            return false;
+        }
+        const size_t size = (size_t)prv_arena_allocator_api_align(sizes[i], ARENA_ALLOCATOR_ALIGNMENT);
+        if (size > SIZE_MAX - total) {
+            return false;
+        }
+        total += size;
+        requested += sizes[i];
+    }
+    uint8_t *batch = prv_arena_allocator_api_bump(harena, total, ARENA_ALLOCATOR_ALIGNMENT, false);
+    if (batch == NULL) {
+        return false;
+    }
+    prv_arena_allocator_api_trace_charge(harena, &site, requested);
+    for (size_t i = 0U; i < count; ++i) {
+        items[i] = batch;
+        batch += prv_arena_allocator_api_align(sizes[i], ARENA_ALLOCATOR_ALIGNMENT);
+    }
+    return true;
+}
+
+bool arena_allocator_api_alloc_n(struct ArenaAllocatorHandler *harena, size_t size, size_t count, void **items) {
+    if (harena == NULL || size == 0U || count == 0U || items == NULL || size > SIZE_MAX - ARENA_ALLOCATOR_ALIGNMENT) {
+        return false;
+    }
+    const struct ArenaAllocatorTraceSite site = prv_arena_allocator_api_trace_take(harena);
+    const size_t stride = (size_t)prv_arena_allocator_api_align(size, ARENA_ALLOCATOR_ALIGNMENT);
+    if (count > SIZE_MAX / stride) {
+        return false;
+    }
+    uint8_t *batch = prv_arena_allocator_api_bump(harena, stride * count, ARENA_ALLOCATOR_ALIGNMENT, false);
+    if (batch == NULL) {
+        return false;
+    }
+    prv_arena_allocator_api_trace_charge(harena, &site, size * count);
+    for (size_t i = 0U; i < count; ++i) {
+        items[i] = batch + i * stride;
+    }
+    return true;
+}
+
+uint32_t arena_allocator_api_alloc_offset(struct ArenaAllocatorHandler *harena, size_t size) {
+    return arena_allocator_api_alloc_offset_aligned(harena, size, ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+uint32_t arena_allocator_api_alloc_offset_aligned(struct ArenaAllocatorHandler *harena, size_t size, size_t align) {
+    if (harena == NULL) {
+        return 0U;
+    }
+    const struct ArenaAllocatorTraceSite site = prv_arena_allocator_api_trace_take(harena);
+    if (size == 0U || align == 0U || (align & (align - 1U)) != 0U) {
+        return 0U;
+    }
+    /*! Offsets are relative to the start of the single region of the arena */
+    if (harena->backend != ARENA_ALLOCATOR_BACKEND_STATIC && harena->backend != ARENA_ALLOCATOR_BACKEND_VM) {
+        return 0U;
+    }
+    const struct ArenaAllocatorMark mark = arena_allocator_api_mark(harena);
+    void *item = prv_arena_allocator_api_bump(harena, size, align, false);
+    if (item == NULL) {
+        return 0U;
+    }
+    const uint32_t offset = arena_allocator_api_offset(harena, item);
+    if (offset == 0U) {
+        /*! The item is beyond the range reachable by an offset */
+        arena_allocator_api_rewind(harena, mark);
+    } else {
+        prv_arena_allocator_api_trace_charge(harena, &site, size);
+    }
+    return offset;
+}
+
+uint32_t arena_allocator_api_offset(const struct ArenaAllocatorHandler *harena, const void *item) {
+    if (harena == NULL || item == NULL || harena->current == NULL) {
+        return 0U;
+    }
+    if (harena->backend != ARENA_ALLOCATOR_BACKEND_STATIC && harena->backend != ARENA_ALLOCATOR_BACKEND_VM) {
+        return 0U;
+    }
+    const uintptr_t base = (uintptr_t)harena->current->value;
+    const uintptr_t address = (uintptr_t)item;
+    if (address < base || address - base >= harena->offset || address - base > UINT32_MAX - ARENA_ALLOCATOR_ALIGNMENT) {
+        return 0U;
+    }
+    return (uint32_t)(address - base + ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+void *arena_allocator_api_realloc(struct ArenaAllocatorHandler *harena, void *item, size_t old_size, size_t new_size) {
+    if (harena == NULL) {
+        return NULL;
+    }
+    const struct ArenaAllocatorTraceSite site = prv_arena_allocator_api_trace_take(harena);
+    if (new_size == 0U) {
+        return NULL;
+    }
+    if (item == NULL) {
+        void *created = prv_arena_allocator_api_bump(harena, new_size, ARENA_ALLOCATOR_ALIGNMENT, false);
+        if (created != NULL) {
+            prv_arena_allocator_api_trace_charge(harena, &site, new_size);
+        }
+        return created;
+    }
+
+    /*!
+     * The last item of the current block can be resized in place, in debug
+     * mode it is always moved to keep its guard bytes
+     */
+#ifndef ARENA_ALLOCATOR_DEBUG
+    if (harena->current != NULL) {
+        const struct ArenaAllocatorItem *block = harena->current;
+        const uintptr_t base = (uintptr_t)block->value;
+        const uintptr_t address = (uintptr_t)item;
+        if (address >= base && address - base <= harena->offset && harena->offset - (address - base) == old_size) {
+            const size_t start = (size_t)(address - base);
+            if (new_size <= block->size - start || prv_arena_allocator_api_vm_commit(harena, start, new_size)) {
+                const size_t end = start + new_size;
+                if (end > harena->clean) {
+                    harena->clean = end;
+                }
+#ifdef ARENA_ALLOCATOR_STATS
+                harena->stats.requested = harena->stats.requested - old_size + new_size;
+                harena->stats.used = harena->stats.used - harena->offset + end;
+                if (harena->stats.used > harena->stats.peak) {
+                    harena->stats.peak = harena->stats.used;
+                }
+#endif // ARENA_ALLOCATOR_STATS
+                harena->offset = end;
+                /*! Only the memory added to the item is taken from the arena */
+                prv_arena_allocator_api_trace_charge(harena, &site, new_size > old_size ? new_size - old_size : 0U);
+                return item;
+            }
+        }
+    }
+#endif // ARENA_ALLOCATOR_DEBUG
+    if (new_size <= old_size) {
+        return item;
+    }
+    void *moved = prv_arena_allocator_api_bump(harena, new_size, ARENA_ALLOCATOR_ALIGNMENT, false);
+    if (moved != NULL) {
+        memcpy(moved, item, old_size);
+        prv_arena_allocator_api_trace_charge(harena, &site, new_size);
+    }
+    return moved;
+}
+
+bool arena_allocator_api_on_free(struct ArenaAllocatorHandler *harena, void *item, void (*dtor)(void *item)) {
+    if (harena == NULL || dtor == NULL) {
+        return false;
+    }
+    /*! The record is part of the bookkeeping of the arena, it is never traced */
+    struct ArenaAllocatorDtor *record = prv_arena_allocator_api_bump(harena, sizeof(struct ArenaAllocatorDtor), _Alignof(struct ArenaAllocatorDtor), false);
+    if (record == NULL) {
+        return false;
+    }
+    record->prev = harena->dtors;
+    record->dtor = dtor;
+    record->item = item;
+    harena->dtors = record;
+    return true;
+}
+
+void *arena_allocator_api_alloc_with_dtor(struct ArenaAllocatorHandler *harena, size_t size, void (*dtor)(void *item)) {
+    if (harena == NULL) {
+        return NULL;
+    }
+    const struct ArenaAllocatorTraceSite site = prv_arena_allocator_api_trace_take(harena);
+    if (size == 0U) {
+        return NULL;
+    }
     /*!
-     * Calloc function its just a shorthand to write alloc with a size equal to
-     * size * count
+     * The record is allocated first so that the item is never left without it,
+     * it is released again if the item does not fit
      */
-    if (harena == NULL || size == 0U || count == 0U) {
+    const struct ArenaAllocatorMark mark = arena_allocator_api_mark(harena);
+    struct ArenaAllocatorDtor *record = NULL;
+    if (dtor != NULL) {
+        record = prv_arena_allocator_api_bump(harena, sizeof(struct ArenaAllocatorDtor), _Alignof(struct ArenaAllocatorDtor), false);
+        if (record == NULL) {
+            return NULL;
+        }
+    }
+    void *item = prv_arena_allocator_api_bump(harena, size, ARENA_ALLOCATOR_ALIGNMENT, false);
+    if (item == NULL) {
+        arena_allocator_api_rewind(harena, mark);
         return NULL;
     }
-    return arena_allocator_api_alloc(harena, size * count);
+    prv_arena_allocator_api_trace_charge(harena, &site, size);
+    if (record == NULL) {
+        return item;
+    }
+    record->prev = harena->dtors;
+    record->dtor = dtor;
+    record->item = item;
+    harena->dtors = record;
+    return item;
+}
+
+struct ArenaAllocatorMark arena_allocator_api_mark(const struct ArenaAllocatorHandler *harena) {
+    struct ArenaAllocatorMark mark = { 0 };
+    if (harena == NULL) {
+        return mark;
+    }
+    mark.size = harena->size;
+    mark.offset = harena->offset;
+    mark.block = harena->current;
+    mark.dtors = harena->dtors;
+#ifdef ARENA_ALLOCATOR_STATS
+    mark.requested = harena->stats.requested;
+    mark.used = harena->stats.used;
+#endif // ARENA_ALLOCATOR_STATS
+    return mark;
+}
+
+void arena_allocator_api_rewind(struct ArenaAllocatorHandler *harena, struct ArenaAllocatorMark mark) {
+    if (harena == NULL) {
+        return;
+    }
+    /*! Marks from the future (i.e. taken before a previous rewind) are ignored */
+    if (mark.size > harena->size || (mark.size == harena->size && mark.offset > harena->offset)) {
+        return;
+    }
+    prv_arena_allocator_api_dtors_run(harena, mark.dtors);
+#ifdef ARENA_ALLOCATOR_DEBUG
+    prv_arena_allocator_api_debug_release(harena, mark.size, mark.offset);
+#endif // ARENA_ALLOCATOR_DEBUG
+    /*!
+     * The blocks pushed after the mark are kept to be reused, the content of
+     * the previous block is not known anymore
+     */
+    if (mark.size < harena->size) {
+        /*! Chunks are never moved, the block of the mark is still valid */
+        if (harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED) {
+            harena->current = mark.block;
+        } else {
+            harena->current = mark.size > 0U ? &harena->items[mark.size - 1U] : NULL;
+        }
+        harena->clean = mark.size > 0U ? harena->current->size : 0U;
+    }
+    harena->size = mark.size;
+    harena->offset = mark.offset;
+#ifdef ARENA_ALLOCATOR_STATS
+    harena->stats.requested = mark.requested;
+    harena->stats.used = mark.used;
+#endif // ARENA_ALLOCATOR_STATS
+}
+
+void arena_allocator_api_reset(struct ArenaAllocatorHandler *harena) {
+    if (harena == NULL) {
+        return;
+    }
+#ifdef ARENA_ALLOCATOR_DEBUG
+    if (!arena_allocator_api_check(harena)) {
+        ARENA_ALLOCATOR_DEBUG_FAIL(harena);
+    }
+#endif // ARENA_ALLOCATOR_DEBUG
+    prv_arena_allocator_api_dtors_run(harena, NULL);
+#ifdef ARENA_ALLOCATOR_DEBUG
+    prv_arena_allocator_api_debug_release(harena, 0U, 0U);
+#endif // ARENA_ALLOCATOR_DEBUG
+#if defined(__linux__)
+    /*!
+     * The committed memory of a virtual memory range is given back to the
+     * system and reads as zero afterwards, the range itself stays reserved
+     */
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_VM) {
+        if (harena->current != NULL) {
+            const bool released = madvise(harena->current->value, harena->current->size, MADV_DONTNEED) == 0;
+            harena->size = 1U;
+            harena->offset = 0U;
+            /*! Old kernels can't release huge pages, their content is then unknown */
+            harena->clean = released ? 0U : harena->current->size;
+        }
+#ifdef ARENA_ALLOCATOR_STATS
+        harena->stats.requested = 0U;
+        harena->stats.used = 0U;
+#endif // ARENA_ALLOCATOR_STATS
+        return;
+    }
+#endif // __linux__
+    /*! All the blocks and the array are kept to be reused */
+    harena->current = NULL;
+    harena->size = 0U;
+    harena->offset = 0U;
+#ifdef ARENA_ALLOCATOR_STATS
+    harena->stats.requested = 0U;
+    harena->stats.used = 0U;
+#endif // ARENA_ALLOCATOR_STATS
 }
 
 void arena_allocator_api_free(struct ArenaAllocatorHandler *harena) {
-    if (harena == NULL || harena->items == NULL) {
+    if (harena == NULL || harena->capacity == 0U) {
         return;
     }
-    /*! Free all individual items */
-    for (size_t i = 0U; i < harena->size; ++i) {
-        void *item = harena->items[i].value;
-        if (item != NULL) {
-            free(item);
+#ifdef ARENA_ALLOCATOR_DEBUG
+    if (!arena_allocator_api_check(harena)) {
+        ARENA_ALLOCATOR_DEBUG_FAIL(harena);
+    }
+#endif // ARENA_ALLOCATOR_DEBUG
+    prv_arena_allocator_api_dtors_run(harena, NULL);
+    /*!
+     * The caller supplied buffer is kept so that the arena can be used again,
+     * it is handed back accessible in case the caller reuses it
+     */
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_STATIC) {
+        arena_allocator_api_reset(harena);
+        PRV_ARENA_ALLOCATOR_API_UNPOISON(harena->items[0U].value, harena->items[0U].size);
+        return;
+    }
+#if defined(__linux__)
+    /*! The whole range is released, the arena must be initialized again */
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_VM) {
+        /*! Only the committed part of the range can be poisoned */
+        PRV_ARENA_ALLOCATOR_API_UNPOISON(harena->items[0U].value, harena->items[0U].size);
+        (void)munmap(harena->items[0U].value, harena->limit);
+        (void)munmap(harena->items, (size_t)sysconf(_SC_PAGESIZE));
+        harena->items = NULL;
+        harena->current = NULL;
+        harena->size = 0U;
+        harena->capacity = 0U;
+        harena->offset = 0U;
+        harena->reserved = 0U;
+        harena->clean = 0U;
+        harena->limit = 0U;
+#ifdef ARENA_ALLOCATOR_STATS
+        harena->stats.requested = 0U;
+        harena->stats.used = 0U;
+        harena->stats.reserved = 0U;
+#endif // ARENA_ALLOCATOR_STATS
+        return;
+    }
+#endif // __linux__
+    /*!
+     * Blocks of a child are given back at once if nothing else was carved
+     * from the parent after them, otherwise they are released with the parent
+     */
+    if (harena->backend == ARENA_ALLOCATOR_BACKEND_CHILD) {
+        struct ArenaAllocatorHandler *parent = harena->parent;
+        if (harena->exclusive && prv_arena_allocator_api_top(parent) == harena->top) {
+            arena_allocator_api_rewind(parent, harena->origin);
+        }
+        arena_allocator_api_init_child(harena, parent);
+        return;
+    }
+    /*! Free all the blocks, the items inside them are released together */
+    struct ArenaAllocatorItem *item = NULL;
+    for (size_t i = 0U; i < harena->reserved; ++i) {
+        item = prv_arena_allocator_api_item_next(harena, item, i - 1U);
+        if (item->value != NULL) {
+            PRV_ARENA_ALLOCATOR_API_UNPOISON(item->value, item->size);
+            free(item->value);
         }
     }
-    /*! Free the arena allocator array */
+    /*! Free the arena allocator array or list of chunks */
     free(harena->items);
+    while (harena->chunks != NULL) {
+        struct ArenaAllocatorItemChunk *next = harena->chunks->next;
+        free(harena->chunks);
+        harena->chunks = next;
+    }
 
+    harena->tail = NULL;
+    harena->spare = NULL;
+    harena->current = NULL;
     harena->size = 0U;
     harena->capacity = 0U;
     harena->items = NULL;
+    harena->offset = 0U;
+    harena->reserved = 0U;
+    harena->clean = 0U;
+#ifdef ARENA_ALLOCATOR_STATS
+    /*! The peak usage and the event counters are kept */
+    harena->stats.requested = 0U;
+    harena->stats.used = 0U;
+    harena->stats.reserved = 0U;
+#endif // ARENA_ALLOCATOR_STATS
+}
+
+bool arena_allocator_api_check(const struct ArenaAllocatorHandler *harena) {
+    if (harena == NULL) {
+        return false;
+    }
+#ifdef ARENA_ALLOCATOR_DEBUG
+    struct ArenaAllocatorItem *item = NULL;
+    for (size_t i = 0U; i < harena->size; ++i) {
+        item = prv_arena_allocator_api_item_next(harena, item, i - 1U);
+        if (item->value != NULL && !prv_arena_allocator_api_debug_check_block(item, item == harena->current ? harena->offset : item->used)) {
+            return false;
+        }
+    }
+#endif // ARENA_ALLOCATOR_DEBUG
+    return true;
+}
+
+bool arena_allocator_api_get_block(const struct ArenaAllocatorHandler *harena, size_t index, struct ArenaAllocatorItem *block) {
+    if (harena == NULL || block == NULL || index >= harena->size) {
+        return false;
+    }
+    const struct ArenaAllocatorItem *item = prv_arena_allocator_api_item_at(harena, index);
+    *block = *item;
+    block->size = item == harena->current ? harena->offset : item->used;
+    return true;
+}
+
+bool arena_allocator_api_get_stats(const struct ArenaAllocatorHandler *harena, struct ArenaAllocatorStats *stats) {
+    if (stats == NULL) {
+        return false;
+    }
+    memset(stats, 0, sizeof(*stats));
+#ifdef ARENA_ALLOCATOR_STATS
+    if (harena == NULL) {
+        return false;
+    }
+    *stats = harena->stats;
+    /*! The memory used to keep track of the blocks is derived from the capacity */
+    const size_t tracking = harena->config.tracking == ARENA_ALLOCATOR_TRACKING_CHUNKED
+        ? harena->capacity / ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * sizeof(struct ArenaAllocatorItemChunk)
+        : harena->capacity * sizeof(struct ArenaAllocatorItem);
+    stats->overhead = tracking + (stats->used - stats->requested);
+    return true;
+#else
+    (void)harena;
+    return false;
+#endif // ARENA_ALLOCATOR_STATS
+}
+
+#ifdef ARENA_ALLOCATOR_TRACE
+/*!
+ * \brief Compare two call sites by the amount of **bytes** they requested.
+ *
+ * \param[in] lhs A reference to the first call site.
+ * \param[in] rhs A reference to the second call site.
+ * \return A negative value if the first call site requested more **bytes**,
+ *      a positive value if it requested less, zero otherwise.
+ */
+static int prv_arena_allocator_api_trace_compare(const void *lhs, const void *rhs) {
+    const struct ArenaAllocatorTraceSite *first = *(const struct ArenaAllocatorTraceSite *const *)lhs;
+    const struct ArenaAllocatorTraceSite *second = *(const struct ArenaAllocatorTraceSite *const *)rhs;
+    return (first->bytes < second->bytes) - (first->bytes > second->bytes);
+}
+#endif // ARENA_ALLOCATOR_TRACE
+
+void *arena_allocator_api_trace_alloc(struct ArenaAllocatorHandler *harena, size_t size, size_t count, size_t align, bool zeroed, const char *file, unsigned int line) {
+    if (harena == NULL || size == 0U || count == 0U || align == 0U || (align & (align - 1U)) != 0U) {
+        return NULL;
+    }
+    /*! The total size of the items should not overflow */
+    if (count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *item = prv_arena_allocator_api_bump(harena, size * count, align, zeroed);
+#ifdef ARENA_ALLOCATOR_TRACE
+    if (item != NULL) {
+        prv_arena_allocator_api_trace_record(harena, size * count, file, line);
+    }
+#else
+    (void)file;
+    (void)line;
+#endif // ARENA_ALLOCATOR_TRACE
+    return item;
+}
+
+struct ArenaAllocatorHandler *arena_allocator_api_trace_at(struct ArenaAllocatorHandler *harena, const char *file, unsigned int line) {
+#ifdef ARENA_ALLOCATOR_TRACE
+    if (harena != NULL) {
+        harena->site.file = file != NULL ? file : "";
+        harena->site.line = line;
+    }
+#else
+    (void)file;
+    (void)line;
+#endif // ARENA_ALLOCATOR_TRACE
+    return harena;
+}
+
+bool arena_allocator_api_trace_dump(const struct ArenaAllocatorHandler *harena, FILE *file) {
+#ifdef ARENA_ALLOCATOR_TRACE
+    if (harena == NULL || file == NULL) {
+        return false;
+    }
+    const struct ArenaAllocatorTraceSite *sites[ARENA_ALLOCATOR_TRACE_SITES];
+    size_t size = 0U;
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_TRACE_SITES; ++i) {
+        if (harena->trace[i].count > 0U) {
+            sites[size++] = &harena->trace[i];
+        }
+    }
+    qsort(sites, size, sizeof(sites[0U]), prv_arena_allocator_api_trace_compare);
+
+    if (fprintf(file, "file,line,count,bytes\n") < 0) {
+        return false;
+    }
+    for (size_t i = 0U; i < size; ++i) {
+        int written = 0;
+        /*! The call sites which did not fit are reported without a location */
+        if (sites[i]->file == NULL) {
+            written = fprintf(file, ",,%zu,%zu\n", sites[i]->count, sites[i]->bytes);
+        } else {
+            written = fprintf(file, "%s,%u,%zu,%zu\n", sites[i]->file, sites[i]->line, sites[i]->count, sites[i]->bytes);
+        }
+        if (written < 0) {
+            return false;
+        }
+    }
+    return fflush(file) == 0;
+#else
+    (void)harena;
+    (void)file;
+    return false;
+#endif // ARENA_ALLOCATOR_TRACE
 }
@@ -0,0 +1,208 @@
+/*!
+ * \file arena-allocator-concurrent-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Thread safe implementation of an arena allocator.
+ * \details The concurrent arena owns a list of large memory blocks shared by
+ *     all the threads, each thread reserves a chunk of the newest block with
+ *     a single atomic operation and then allocates its items from that chunk
+ *     without any synchronization (bump allocation).
+ *     The shared block list is updated only when a chunk is exhausted and a
+ *     new block is pushed without locks when the newest one is full.
+ *     All the memory is freed at once by a single call.
+ *
+ * \warning Memory handled by the arena allocator should not be freed outside
+ *      of the allocator itself.
+ *      This might caused undefined behavior caused by double free of the same
+ *      memory region.
+ */
+#ifndef __STDC_NO_ATOMICS__
+
+#include "arena-allocator-concurrent.h"
+#include "arena-allocator-concurrent-api.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+
+/*! Offset of the usable memory from the start of a block */
+#define PRV_ARENA_ALLOCATOR_CONCURRENT_BLOCK_HEADER \
+    ((sizeof(struct ArenaAllocatorConcurrentBlock) + ARENA_ALLOCATOR_ALIGNMENT - 1U) & ~(ARENA_ALLOCATOR_ALIGNMENT - 1U))
+
+/*!
+ * \brief Round an address up to the next multiple of the given alignment.
+ *
+ * \param[in] value The address to align.
+ * \param[in] align The alignment, must be a power of two.
+ * \return The aligned address.
+ */
+static uintptr_t prv_arena_allocator_concurrent_api_align(uintptr_t value, size_t align) {
+    return (value + align - 1U) & ~((uintptr_t)align - 1U);
+}
+
+/*!
+ * \brief Reserve a chunk of the newest block of the shared arena.
+ * \details The chunk is reserved with a compare and swap loop on the block
+ *      offset so that no thread ever waits for another one.
+ *
+ * \param[in] block A reference to the block.
+ * \param[in] size  The size of the chunk in **bytes**.
+ * \return The address of the chunk or 0 if the block is full.
+ */
+static uintptr_t prv_arena_allocator_concurrent_api_block_reserve(struct ArenaAllocatorConcurrentBlock *block, size_t size) {
+    assert(block != NULL);
+
+    size_t offset = atomic_load_explicit(&block->offset, memory_order_relaxed);
+    do {
+        if (offset > block->size || size > block->size - offset) {
+            return 0U;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&block->offset, &offset, offset + size, memory_order_relaxed, memory_order_relaxed));
+    return (uintptr_t)block + PRV_ARENA_ALLOCATOR_CONCURRENT_BLOCK_HEADER + offset;
+}
+
+/*!
+ * \brief Reserve a chunk of memory from the shared arena.
+ * \details If the newest block is full a new one is allocated with the chunk
+ *      already reserved inside it and then pushed on top of the list.
+ *
+ * \param[in] hconcurrent A reference to the concurrent arena allocator handler.
+ * \param[in] size        The size of the chunk in **bytes**.
+ * \return The address of the chunk or 0 on failure.
+ */
+static uintptr_t prv_arena_allocator_concurrent_api_reserve(struct ArenaAllocatorConcurrentHandler *hconcurrent, size_t size) {
+    assert(hconcurrent != NULL);
+    assert(size > 0U);
+
+    struct ArenaAllocatorConcurrentBlock *head = atomic_load_explicit(&hconcurrent->head, memory_order_acquire);
+    if (head != NULL) {
+        uintptr_t chunk = prv_arena_allocator_concurrent_api_block_reserve(head, size);
+        if (chunk != 0U) {
+            return chunk;
+        }
+    }
+
+    const size_t block_size = size > ARENA_ALLOCATOR_CONCURRENT_BLOCK_SIZE ? size : ARENA_ALLOCATOR_CONCURRENT_BLOCK_SIZE;
+    if (block_size > SIZE_MAX - PRV_ARENA_ALLOCATOR_CONCURRENT_BLOCK_HEADER) {
+        return 0U;
+    }
+    struct ArenaAllocatorConcurrentBlock *block = (struct ArenaAllocatorConcurrentBlock *)malloc(PRV_ARENA_ALLOCATOR_CONCURRENT_BLOCK_HEADER + block_size);
+    if (block == NULL) {
+        return 0U;
+    }
+    block->size = block_size;
+    atomic_init(&block->offset, size);
+
+    /*!
+     * Push the new block on top of the list, if another thread pushed a block
+     * in the meantime the new one is simply placed on top of it
+     */
+    block->next = head;
+    while (!atomic_compare_exchange_weak_explicit(&hconcurrent->head, &block->next, block, memory_order_acq_rel, memory_order_acquire)) {
+    }
+    return (uintptr_t)block + PRV_ARENA_ALLOCATOR_CONCURRENT_BLOCK_HEADER;
+}
+
+/*!
+ * \brief Carves a new item out of the chunk of the cache.
+ *
+ * \param[in] hcache A reference to the cache.
+ * \param[in] size   The size of the item to allocate in **bytes**.
+ * \param[in] align  The alignment of the item in **bytes**, must be a power of two.
+ * \return A reference to the newly allocated item or NULL if it does not fit
+ *      inside the chunk.
+ */
+static void *prv_arena_allocator_concurrent_api_chunk_carve(struct ArenaAllocatorConcurrentCache *hcache, size_t size, size_t align) {
+    assert(hcache != NULL);
+
+    const uintptr_t start = prv_arena_allocator_concurrent_api_align(hcache->cursor, align);
+    if (start < hcache->cursor || start > hcache->limit || size > hcache->limit - start) {
+        return NULL;
+    }
+    hcache->cursor = start + size;
+    return (void *)start;
+}
+
+void arena_allocator_concurrent_api_init(struct ArenaAllocatorConcurrentHandler *hconcurrent) {
+    if (hconcurrent == NULL) {
+        return;
+    }
+    atomic_init(&hconcurrent->head, NULL);
+}
+
+void arena_allocator_concurrent_api_cache_init(struct ArenaAllocatorConcurrentCache *hcache, struct ArenaAllocatorConcurrentHandler *hconcurrent) {
+    if (hcache == NULL) {
+        return;
+    }
+    hcache->hconcurrent = hconcurrent;
+    hcache->cursor = 0U;
+    hcache->limit = 0U;
+}
+
+void *arena_allocator_concurrent_api_alloc(struct ArenaAllocatorConcurrentCache *hcache, size_t size) {
+    return arena_allocator_concurrent_api_alloc_aligned(hcache, size, ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+void *arena_allocator_concurrent_api_alloc_aligned(struct ArenaAllocatorConcurrentCache *hcache, size_t size, size_t align) {
+    if (hcache == NULL || hcache->hconcurrent == NULL || size == 0U || align == 0U || (align & (align - 1U)) != 0U) {
+        return NULL;
+    }
+    void *item = prv_arena_allocator_concurrent_api_chunk_carve(hcache, size, align);
+    if (item != NULL) {
+        return item;
+    }
+
+    /*! Chunks always start aligned, reserve room for the worst case padding */
+    const size_t padding = align > ARENA_ALLOCATOR_ALIGNMENT ? align - ARENA_ALLOCATOR_ALIGNMENT : 0U;
+    if (size > SIZE_MAX - padding - ARENA_ALLOCATOR_ALIGNMENT) {
+        return NULL;
+    }
+    /*! Chunks are always a multiple of the alignment to keep the next ones aligned */
+    const size_t need = (size_t)prv_arena_allocator_concurrent_api_align(size + padding, ARENA_ALLOCATOR_ALIGNMENT);
+    if (need > ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE) {
+        /*! Big items get a dedicated chunk and the current one is kept */
+        const uintptr_t chunk = prv_arena_allocator_concurrent_api_reserve(hcache->hconcurrent, need);
+        if (chunk == 0U) {
+            return NULL;
+        }
+        return (void *)prv_arena_allocator_concurrent_api_align(chunk, align);
+    }
+    const uintptr_t chunk = prv_arena_allocator_concurrent_api_reserve(hcache->hconcurrent, ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE);
+    if (chunk == 0U) {
+        return NULL;
+    }
+    hcache->cursor = chunk;
+    hcache->limit = chunk + ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE;
+    return prv_arena_allocator_concurrent_api_chunk_carve(hcache, size, align);
+}
+
+void *arena_allocator_concurrent_api_calloc(struct ArenaAllocatorConcurrentCache *hcache, size_t size, size_t count) {
+    if (hcache == NULL || size == 0U || count == 0U) {
+        return NULL;
+    }
+    /*! The total size of the items should not overflow */
+    if (count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *item = arena_allocator_concurrent_api_alloc(hcache, size * count);
+    if (item != NULL) {
+        memset(item, 0, size * count);
+    }
+    return item;
+}
+
+void arena_allocator_concurrent_api_free(struct ArenaAllocatorConcurrentHandler *hconcurrent) {
+    if (hconcurrent == NULL) {
+        return;
+    }
+    struct ArenaAllocatorConcurrentBlock *block = atomic_exchange(&hconcurrent->head, NULL);
+    while (block != NULL) {
+        struct ArenaAllocatorConcurrentBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+#endif // __STDC_NO_ATOMICS__
@@ -0,0 +1,100 @@
+/*!
+ * \file arena-allocator-pool-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Pool allocator layered on top of an arena allocator.
+ * \details The pool serves items of a limited set of size classes (powers of
+ *     two) from an arena and keeps an intrusive free list for each class, so
+ *     that single items can be released and recycled in constant time.
+ *     The memory of the items is never given back to the arena, it is freed
+ *     at once with the arena itself.
+ *
+ * \warning Memory handled by the arena allocator should not be freed outside
+ *      of the allocator itself.
+ *      This might caused undefined behavior caused by double free of the same
+ *      memory region.
+ */
+#include "arena-allocator-pool.h"
+#include "arena-allocator-pool-api.h"
+#include "arena-allocator-api.h"
+
+#ifdef ARENA_ALLOCATOR_TRACE
+/*! The allocation function of the pool is defined with its own name and the arena is called untraced */
+#undef arena_allocator_pool_api_alloc
+#undef arena_allocator_api_alloc
+#endif // ARENA_ALLOCATOR_TRACE
+
+#include <string.h>
+
+/*!
+ * \brief Get the size class of an item.
+ *
+ * \param[in] size The size of the item in **bytes**.
+ * \return The index of the smallest class which fits the item or
+ *      \ref ARENA_ALLOCATOR_POOL_CLASSES if the item is too big.
+ */
+static size_t prv_arena_allocator_pool_api_class(size_t size) {
+    size_t index = 0U;
+    size_t class_size = ARENA_ALLOCATOR_ALIGNMENT;
+    while (index < ARENA_ALLOCATOR_POOL_CLASSES && size > class_size) {
+        class_size <<= 1U;
+        ++index;
+    }
+    return index;
+}
+
+void arena_allocator_pool_api_init(struct ArenaAllocatorPoolHandler *hpool, struct ArenaAllocatorHandler *harena) {
+    if (hpool == NULL) {
+        return;
+    }
+    memset(hpool, 0, sizeof(*hpool));
+    hpool->harena = harena;
+}
+
+void *arena_allocator_pool_api_alloc(struct ArenaAllocatorPoolHandler *hpool, size_t size) {
+    return arena_allocator_pool_api_trace_alloc(hpool, size, NULL, 0U);
+}
+
+void *arena_allocator_pool_api_trace_alloc(struct ArenaAllocatorPoolHandler *hpool, size_t size, const char *file, unsigned int line) {
+    if (hpool == NULL || size == 0U) {
+        return NULL;
+    }
+    const size_t index = prv_arena_allocator_pool_api_class(size);
+    if (index >= ARENA_ALLOCATOR_POOL_CLASSES) {
+        return NULL;
+    }
+
+    /*! Reuse the most recently released item, which is likely still cached */
+    struct ArenaAllocatorPoolNode *node = hpool->free[index];
+    if (node != NULL) {
+        hpool->free[index] = node->next;
+        return node;
+    }
+    const size_t class_size = (size_t)ARENA_ALLOCATOR_ALIGNMENT << index;
+    if (file == NULL) {
+        return arena_allocator_api_alloc(hpool->harena, class_size);
+    }
+    return arena_allocator_api_trace_alloc(hpool->harena, class_size, 1U, ARENA_ALLOCATOR_ALIGNMENT, false, file, line);
+}
+
+void arena_allocator_pool_api_free(struct ArenaAllocatorPoolHandler *hpool, void *item, size_t size) {
+    if (hpool == NULL || item == NULL || size == 0U) {
+        return;
+    }
+    const size_t index = prv_arena_allocator_pool_api_class(size);
+    if (index >= ARENA_ALLOCATOR_POOL_CLASSES) {
+        return;
+    }
+
+    struct ArenaAllocatorPoolNode *node = (struct ArenaAllocatorPoolNode *)item;
+    node->next = hpool->free[index];
+    hpool->free[index] = node;
+}
+
+void arena_allocator_pool_api_reset(struct ArenaAllocatorPoolHandler *hpool) {
+    if (hpool == NULL) {
+        return;
+    }
+    memset(hpool->free, 0, sizeof(hpool->free));
+}
@@ -0,0 +1,167 @@
+/*!
+ * \file arena-allocator-ring-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Lock-free ring arena for a single producer and a single consumer.
+ * \details The ring arena allocates records of variable size over a caller
+ *     supplied buffer: the producer carves them at the head by bumping an
+ *     offset and the consumer releases them from the tail in the same order,
+ *     so that messages are passed between them without copies, locks or
+ *     heap allocations.
+ *     A record which does not fit before the end of the buffer is placed at
+ *     its start and the space left at the end is skipped.
+ *
+ * \warning The producer and the consumer can run concurrently (e.g. an ISR
+ *      and the main loop or two threads) but there must be only one of each.
+ */
+#ifndef __STDC_NO_ATOMICS__
+
+#include "arena-allocator-ring.h"
+#include "arena-allocator-ring-api.h"
+
+#include <assert.h>
+#include <string.h>
+
+/*!
+ * \brief Space taken by the header of a record, every record and position of
+ *      the ring is a multiple of it.
+ */
+#define PRV_ARENA_ALLOCATOR_RING_API_HEADER \
+    ((sizeof(struct ArenaAllocatorRingRecord) + ARENA_ALLOCATOR_ALIGNMENT - 1U) & ~(ARENA_ALLOCATOR_ALIGNMENT - 1U))
+
+/*!
+ * \brief Get the header of the record at a given position of the ring.
+ *
+ * \param[in] hring    A reference to the ring arena allocator handler.
+ * \param[in] position The position of the record.
+ * \return A reference to the header of the record.
+ */
+static struct ArenaAllocatorRingRecord *prv_arena_allocator_ring_api_record(const struct ArenaAllocatorRingHandler *hring, size_t position) {
+    assert(hring != NULL);
+
+    return (struct ArenaAllocatorRingRecord *)(hring->buffer + (position & (hring->capacity - 1U)));
+}
+
+/*!
+ * \brief Find the oldest committed record of the ring.
+ * \details The space skipped at the end of the buffer is jumped over.
+ *
+ * \param[in] hring     A reference to the ring arena allocator handler.
+ * \param[out] position The reference where the position of the record is stored.
+ * \return A reference to the header of the record or NULL if the ring is empty.
+ */
+static struct ArenaAllocatorRingRecord *prv_arena_allocator_ring_api_oldest(struct ArenaAllocatorRingHandler *hring, size_t *position) {
+    assert(hring != NULL);
+    assert(position != NULL);
+
+    /*! The records up to the head are completely written by the producer */
+    const size_t head = atomic_load_explicit(&hring->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&hring->tail, memory_order_relaxed);
+    while (tail != head) {
+        struct ArenaAllocatorRingRecord *record = prv_arena_allocator_ring_api_record(hring, tail);
+        if (record->length > 0U) {
+            *position = tail;
+            return record;
+        }
+        tail += record->size;
+    }
+    return NULL;
+}
+
+bool arena_allocator_ring_api_init(struct ArenaAllocatorRingHandler *hring, void *buffer, size_t size) {
+    if (hring == NULL) {
+        return false;
+    }
+    memset(hring, 0, sizeof(*hring));
+    atomic_init(&hring->head, 0U);
+    atomic_init(&hring->tail, 0U);
+    if (buffer == NULL) {
+        return false;
+    }
+    const uintptr_t begin = (uintptr_t)buffer;
+    const uintptr_t start = (begin + ARENA_ALLOCATOR_ALIGNMENT - 1U) & ~((uintptr_t)ARENA_ALLOCATOR_ALIGNMENT - 1U);
+    if (start < begin || start - begin >= size) {
+        return false;
+    }
+    /*! A power of two capacity keeps the positions valid when they overflow */
+    const size_t available = size - (size_t)(start - begin);
+    size_t capacity = PRV_ARENA_ALLOCATOR_RING_API_HEADER;
+    while (capacity <= available / 2U) {
+        capacity *= 2U;
+    }
+    /*! At least a record with its header must fit inside the ring */
+    if (capacity > available || capacity < 2U * PRV_ARENA_ALLOCATOR_RING_API_HEADER) {
+        return false;
+    }
+    hring->buffer = (uint8_t *)start;
+    hring->capacity = capacity;
+    return true;
+}
+
+void *arena_allocator_ring_api_alloc(struct ArenaAllocatorRingHandler *hring, size_t size) {
+    if (hring == NULL || hring->buffer == NULL || size == 0U || size > hring->capacity) {
+        return NULL;
+    }
+    const size_t needed = PRV_ARENA_ALLOCATOR_RING_API_HEADER +
+        ((size + PRV_ARENA_ALLOCATOR_RING_API_HEADER - 1U) / PRV_ARENA_ALLOCATOR_RING_API_HEADER) * PRV_ARENA_ALLOCATOR_RING_API_HEADER;
+    /*! The space released by the consumer can be reused only after it is read */
+    const size_t tail = atomic_load_explicit(&hring->tail, memory_order_acquire);
+    const size_t available = hring->capacity - (hring->reserved - tail);
+    const size_t contiguous = hring->capacity - (hring->reserved & (hring->capacity - 1U));
+    /*! A record never wraps around, it is moved to the start of the buffer */
+    const size_t skipped = needed > contiguous ? contiguous : 0U;
+    if (needed > hring->capacity || skipped > available || needed > available - skipped) {
+        return NULL;
+    }
+    if (skipped > 0U) {
+        struct ArenaAllocatorRingRecord *record = prv_arena_allocator_ring_api_record(hring, hring->reserved);
+        record->size = skipped;
+        record->length = 0U;
+        hring->reserved += skipped;
+    }
+    struct ArenaAllocatorRingRecord *record = prv_arena_allocator_ring_api_record(hring, hring->reserved);
+    record->size = needed;
+    record->length = size;
+    hring->reserved += needed;
+    return (uint8_t *)record + PRV_ARENA_ALLOCATOR_RING_API_HEADER;
+}
+
+void arena_allocator_ring_api_commit(struct ArenaAllocatorRingHandler *hring) {
+    if (hring == NULL) {
+        return;
+    }
+    /*! The content of the records is published together with the head */
+    atomic_store_explicit(&hring->head, hring->reserved, memory_order_release);
+}
+
+void *arena_allocator_ring_api_peek(struct ArenaAllocatorRingHandler *hring, size_t *size) {
+    if (hring == NULL || hring->buffer == NULL) {
+        return NULL;
+    }
+    size_t position = 0U;
+    struct ArenaAllocatorRingRecord *record = prv_arena_allocator_ring_api_oldest(hring, &position);
+    if (record == NULL) {
+        return NULL;
+    }
+    if (size != NULL) {
+        *size = record->length;
+    }
+    return (uint8_t *)record + PRV_ARENA_ALLOCATOR_RING_API_HEADER;
+}
+
+bool arena_allocator_ring_api_release(struct ArenaAllocatorRingHandler *hring) {
+    if (hring == NULL || hring->buffer == NULL) {
+        return false;
+    }
+    size_t position = 0U;
+    const struct ArenaAllocatorRingRecord *record = prv_arena_allocator_ring_api_oldest(hring, &position);
+    if (record == NULL) {
+        return false;
+    }
+    /*! The record is completely read before its space is given back */
+    atomic_store_explicit(&hring->tail, position + record->size, memory_order_release);
+    return true;
+}
+
+#endif // __STDC_NO_ATOMICS__
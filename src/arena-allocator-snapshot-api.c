@@ -0,0 +1,296 @@
+/*!
+ * \file arena-allocator-snapshot-api.c
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Snapshot of the content of an arena allocator.
+ * \details The used part of every block of an arena is written to a file as
+ *     a single contiguous image which can later be mapped read-only, without
+ *     any parsing, by any number of processes.
+ *     Items inside the image refer to each other through offsets instead of
+ *     pointers so that the image can be mapped at any address.
+ */
+#if defined(__unix__) && !defined(_POSIX_C_SOURCE)
+/*! Needed by mmap and the file descriptors functions with strict standard modes */
+#define _POSIX_C_SOURCE 200809L
+#endif // __unix__
+
+#include "arena-allocator-snapshot.h"
+#include "arena-allocator-snapshot-api.h"
+#include "arena-allocator-api.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // __unix__
+
+/*! The guard bytes of the items are written as well in debug mode */
+#if defined(ARENA_ALLOCATOR_DEBUG)
+#if defined(__SANITIZE_ADDRESS__)
+#define PRV_ARENA_ALLOCATOR_SNAPSHOT_API_ASAN
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define PRV_ARENA_ALLOCATOR_SNAPSHOT_API_ASAN
+#endif // __has_feature
+#endif // __SANITIZE_ADDRESS__
+#endif // ARENA_ALLOCATOR_DEBUG
+
+#if defined(PRV_ARENA_ALLOCATOR_SNAPSHOT_API_ASAN)
+/*!
+ * \brief Copy memory which may contain poisoned guard bytes.
+ * \details The function is not instrumented by ASan, so the poisoning of the
+ *      arena is left untouched.
+ *
+ * \param[out] destination The memory where the bytes are copied.
+ * \param[in]  source      The memory to copy.
+ * \param[in]  size        The number of **bytes** to copy.
+ */
+__attribute__((no_sanitize_address)) static void prv_arena_allocator_snapshot_api_copy(uint8_t *destination, const volatile uint8_t *source, size_t size) {
+    for (size_t i = 0U; i < size; ++i) {
+        destination[i] = source[i];
+    }
+}
+#endif // PRV_ARENA_ALLOCATOR_SNAPSHOT_API_ASAN
+
+/*!
+ * \brief Get the offset of a block inside the snapshot.
+ * \details The block is placed at the first offset with the same remainder as
+ *      its address, so that the alignment of its items is preserved.
+ *
+ * \param[in] position The first free offset of the snapshot.
+ * \param[in] address  The address of the block.
+ * \return The offset of the block.
+ */
+static size_t prv_arena_allocator_snapshot_api_block_start(size_t position, uintptr_t address) {
+    const size_t mask = ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT - 1U;
+    const size_t start = (position & ~mask) | ((size_t)address & mask);
+    return start < position ? start + ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT : start;
+}
+
+/*!
+ * \brief Write a number of zero bytes to a file.
+ *
+ * \param[in] file  The file.
+ * \param[in] count The number of **bytes** to write.
+ * \return True on success, false otherwise.
+ */
+static bool prv_arena_allocator_snapshot_api_pad(FILE *file, size_t count) {
+    static const uint8_t zeros[ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT] = { 0U };
+    while (count > 0U) {
+        const size_t chunk = count < sizeof(zeros) ? count : sizeof(zeros);
+        if (fwrite(zeros, 1U, chunk, file) != chunk) {
+            return false;
+        }
+        count -= chunk;
+    }
+    return true;
+}
+
+/*!
+ * \brief Write the used part of a block to a file.
+ *
+ * \param[in] file  The file.
+ * \param[in] block A reference to the memory of the block.
+ * \param[in] size  The number of **bytes** to write.
+ * \return True on success, false otherwise.
+ */
+static bool prv_arena_allocator_snapshot_api_write(FILE *file, const void *block, size_t size) {
+#if defined(PRV_ARENA_ALLOCATOR_SNAPSHOT_API_ASAN)
+    /*! The items are copied through a buffer since the guard bytes are poisoned */
+    uint8_t buffer[256U];
+    const uint8_t *source = (const uint8_t *)block;
+    while (size > 0U) {
+        const size_t chunk = size < sizeof(buffer) ? size : sizeof(buffer);
+        prv_arena_allocator_snapshot_api_copy(buffer, source, chunk);
+        if (fwrite(buffer, 1U, chunk, file) != chunk) {
+            return false;
+        }
+        source += chunk;
+        size -= chunk;
+    }
+    return true;
+#else
+    return fwrite(block, 1U, size, file) == size;
+#endif // PRV_ARENA_ALLOCATOR_SNAPSHOT_API_ASAN
+}
+
+/*!
+ * \brief Check that the header of a loaded file describes a valid snapshot.
+ *
+ * \param[in] base The start of the loaded file.
+ * \param[in] size The size of the loaded file in **bytes**.
+ * \return True if the snapshot is valid, false otherwise.
+ */
+static bool prv_arena_allocator_snapshot_api_valid(const void *base, size_t size) {
+    struct ArenaAllocatorSnapshotHeader header;
+    memcpy(&header, base, sizeof(header));
+    return header.magic == ARENA_ALLOCATOR_SNAPSHOT_MAGIC && header.version == ARENA_ALLOCATOR_SNAPSHOT_VERSION &&
+        header.size == (uint64_t)size && header.root < (uint64_t)size && header.first < (uint64_t)size;
+}
+
+size_t arena_allocator_snapshot_api_offset(const struct ArenaAllocatorHandler *harena, const void *item) {
+    if (harena == NULL || item == NULL) {
+        return 0U;
+    }
+    const uintptr_t address = (uintptr_t)item;
+    size_t position = sizeof(struct ArenaAllocatorSnapshotHeader);
+    struct ArenaAllocatorItem block;
+    for (size_t i = 0U; arena_allocator_api_get_block(harena, i, &block); ++i) {
+        const uintptr_t base = (uintptr_t)block.value;
+        const size_t start = prv_arena_allocator_snapshot_api_block_start(position, base);
+        if (address >= base && address - base < block.size) {
+            return start + (size_t)(address - base);
+        }
+        position = start + block.size;
+    }
+    return 0U;
+}
+
+bool arena_allocator_snapshot_api_save(const struct ArenaAllocatorHandler *harena, const void *root, const char *path) {
+    if (harena == NULL || path == NULL) {
+        return false;
+    }
+    struct ArenaAllocatorSnapshotHeader header = {
+        .magic = ARENA_ALLOCATOR_SNAPSHOT_MAGIC,
+        .version = ARENA_ALLOCATOR_SNAPSHOT_VERSION,
+        .size = 0U,
+        .root = arena_allocator_snapshot_api_offset(harena, root),
+        .first = 0U,
+    };
+    if (root != NULL && header.root == 0U) {
+        return false;
+    }
+
+    /*! The size of the whole file is needed before writing the blocks */
+    size_t position = sizeof(header);
+    struct ArenaAllocatorItem block;
+    for (size_t i = 0U; arena_allocator_api_get_block(harena, i, &block); ++i) {
+        const size_t start = prv_arena_allocator_snapshot_api_block_start(position, (uintptr_t)block.value);
+        if (i == 0U) {
+            header.first = start;
+        }
+        position = start + block.size;
+    }
+    header.size = position;
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+    bool result = fwrite(&header, sizeof(header), 1U, file) == 1U;
+    position = sizeof(header);
+    for (size_t i = 0U; result && arena_allocator_api_get_block(harena, i, &block); ++i) {
+        const size_t start = prv_arena_allocator_snapshot_api_block_start(position, (uintptr_t)block.value);
+        result = prv_arena_allocator_snapshot_api_pad(file, start - position) && prv_arena_allocator_snapshot_api_write(file, block.value, block.size);
+        position = start + block.size;
+    }
+    if (fclose(file) != 0) {
+        result = false;
+    }
+    return result;
+}
+
+bool arena_allocator_snapshot_api_load(struct ArenaAllocatorSnapshotHandler *hsnapshot, const char *path) {
+    if (hsnapshot == NULL) {
+        return false;
+    }
+    memset(hsnapshot, 0, sizeof(*hsnapshot));
+    if (path == NULL) {
+        return false;
+    }
+#if defined(__unix__)
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(struct ArenaAllocatorSnapshotHeader)) {
+        close(fd);
+        return false;
+    }
+    const size_t size = (size_t)info.st_size;
+    void *base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    /*! The mapping keeps the file referenced after the descriptor is closed */
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    if (!prv_arena_allocator_snapshot_api_valid(base, size)) {
+        munmap(base, size);
+        return false;
+    }
+    hsnapshot->mapped = true;
+#else
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    long end = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        end = ftell(file);
+    }
+    if (end < (long)sizeof(struct ArenaAllocatorSnapshotHeader) || fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return false;
+    }
+    const size_t size = (size_t)end;
+    void *base = malloc(size);
+    if (base == NULL || fread(base, 1U, size, file) != size || !prv_arena_allocator_snapshot_api_valid(base, size)) {
+        free(base);
+        fclose(file);
+        return false;
+    }
+    fclose(file);
+    hsnapshot->mapped = false;
+#endif // __unix__
+    struct ArenaAllocatorSnapshotHeader header;
+    memcpy(&header, base, sizeof(header));
+    hsnapshot->base = base;
+    hsnapshot->size = size;
+    hsnapshot->root = (size_t)header.root;
+    hsnapshot->first = (size_t)header.first;
+    return true;
+}
+
+const void *arena_allocator_snapshot_api_root(const struct ArenaAllocatorSnapshotHandler *hsnapshot) {
+    if (hsnapshot == NULL) {
+        return NULL;
+    }
+    return arena_allocator_snapshot_api_resolve(hsnapshot, hsnapshot->root);
+}
+
+const void *arena_allocator_snapshot_api_resolve(const struct ArenaAllocatorSnapshotHandler *hsnapshot, size_t offset) {
+    if (hsnapshot == NULL || hsnapshot->base == NULL || offset < sizeof(struct ArenaAllocatorSnapshotHeader) || offset >= hsnapshot->size) {
+        return NULL;
+    }
+    return (const uint8_t *)hsnapshot->base + offset;
+}
+
+const void *arena_allocator_snapshot_api_resolve_handle(const struct ArenaAllocatorSnapshotHandler *hsnapshot, uint32_t offset) {
+    if (hsnapshot == NULL || hsnapshot->first == 0U || offset < ARENA_ALLOCATOR_ALIGNMENT) {
+        return NULL;
+    }
+    /*! The offsets of the arena are counted from ARENA_ALLOCATOR_ALIGNMENT bytes before its first block */
+    return arena_allocator_snapshot_api_resolve(hsnapshot, hsnapshot->first + ((size_t)offset - ARENA_ALLOCATOR_ALIGNMENT));
+}
+
+void arena_allocator_snapshot_api_unload(struct ArenaAllocatorSnapshotHandler *hsnapshot) {
+    if (hsnapshot == NULL || hsnapshot->base == NULL) {
+        return;
+    }
+#if defined(__unix__)
+    if (hsnapshot->mapped) {
+        munmap((void *)hsnapshot->base, hsnapshot->size);
+    }
+#endif // __unix__
+    if (!hsnapshot->mapped) {
+        free((void *)hsnapshot->base);
+    }
+    memset(hsnapshot, 0, sizeof(*hsnapshot));
+}
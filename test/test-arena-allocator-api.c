@@ -8,12 +8,41 @@
 
 #include "unity.h"
 #include "arena-allocator-api.h"
-
+#include "arena-allocator-concurrent-api.h"
+#include "arena-allocator-pool-api.h"
+#include "arena-allocator-ring-api.h"
+#include "arena-allocator-snapshot-api.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__)
+#include <pthread.h>
+#include <sched.h>
+#endif // __unix__
+
+#if defined(ARENA_ALLOCATOR_DEBUG) && defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/asan_interface.h>
+#endif // ARENA_ALLOCATOR_DEBUG
 
 /*! Function declaration needed to test the source only functions */
-void *prv_arena_allocator_api_item_push(struct ArenaAllocatorHandler *harena, size_t size);
-void *prv_arena_allocator_api_item_push_with_alloc(struct ArenaAllocatorHandler *harena, size_t size);
+void *prv_arena_allocator_api_item_push(struct ArenaAllocatorHandler *harena, size_t size, bool zeroed);
+void *prv_arena_allocator_api_item_push_with_alloc(struct ArenaAllocatorHandler *harena, size_t size, bool zeroed);
+void *prv_arena_allocator_api_bump(struct ArenaAllocatorHandler *harena, size_t size, size_t align, bool zeroed);
+
+/*! Tests of the C++ wrapper defined in test-arena-allocator-wrapper.cpp */
+void test_arena_allocator_wrapper_make_registers_dtor(void);
+void test_arena_allocator_wrapper_make_trivial_without_dtor(void);
+void test_arena_allocator_wrapper_make_when_full(void);
+void test_arena_allocator_wrapper_free_runs_dtors(void);
+void test_arena_allocator_wrapper_rewind_runs_dtors(void);
+void test_arena_allocator_wrapper_allocator_equality(void);
+void test_arena_allocator_wrapper_allocator_rebind(void);
+void test_arena_allocator_wrapper_allocate_with_zero_size(void);
+void test_arena_allocator_wrapper_memory_resource_equality(void);
 
 struct ArenaAllocatorHandler harena;
 
@@ -34,7 +63,7 @@ void test_arena_allocator_api_item_push_address(void) {
     const size_t size = sizeof(*harena.items);
     harena.items = malloc(size);
     harena.capacity = 1U;
-    void *item = prv_arena_allocator_api_item_push(&harena, size);
+    void *item = prv_arena_allocator_api_item_push(&harena, size, false);
     TEST_ASSERT_EQUAL_PTR(harena.items[0U].value, item);
 }
 
@@ -42,7 +71,7 @@ void test_arena_allocator_api_item_push_arena_size(void) {
     const size_t size = sizeof(*harena.items);
     harena.items = malloc(size);
     harena.capacity = 1U;
-    (void)prv_arena_allocator_api_item_push(&harena, size);
+    (void)prv_arena_allocator_api_item_push(&harena, size, false);
     TEST_ASSERT_EQUAL_size_t(1U, harena.size);
 }
 
@@ -55,13 +84,13 @@ void test_arena_allocator_api_item_push_arena_size(void) {
 
 void test_arena_allocator_api_item_push_with_alloc_when_zero_capacity_arena_address(void) {
     const size_t size = sizeof(int);
-    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
     TEST_ASSERT_NOT_NULL(harena.items);
 }
 
 void test_arena_allocator_api_item_push_with_alloc_when_zero_capacity_capacity(void) {
     const size_t size = sizeof(int);
-    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
     TEST_ASSERT_EQUAL_size_t(1U, harena.capacity);
 }
 
@@ -70,9 +99,9 @@ void test_arena_allocator_api_item_push_with_alloc_when_full_arena_address(void)
     /*! Test with power of two since the arena capacity doubles whenever it is full */
     const size_t n = 1U << 1U;
     for (size_t i = 0U; i < n; ++i)
-        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
 
-    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
     TEST_ASSERT_NOT_NULL(harena.items);
 }
 
@@ -81,9 +110,9 @@ void test_arena_allocator_api_item_push_with_alloc_when_full_capacity(void) {
     /*! Test with power of two since the arena capacity doubles whenever it is full */
     const size_t n = 1U << 1U;
     for (size_t i = 0U; i < n; ++i)
-        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
 
-    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
     TEST_ASSERT_EQUAL_size_t(n * 2U, harena.capacity);
 }
 
@@ -92,10 +121,10 @@ void test_arena_allocator_api_item_push_with_alloc_without_realloc_address(void)
     /*! Test with 3 items pushed so that the capacity is greater */
     const size_t n = 3U;
     for (size_t i = 0U; i < n; ++i)
-        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
 
     void *expected = harena.items;
-    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
     TEST_ASSERT_EQUAL_PTR(expected, harena.items);
 }
 
@@ -104,14 +133,75 @@ void test_arena_allocator_api_item_push_with_alloc_without_realloc_arena_size(vo
     /*! Test with 3 items pushed so that the capacity is greater */
     const size_t n = 3U;
     for (size_t i = 0U; i < n; ++i)
-        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
 
-    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, size, false);
     TEST_ASSERT_EQUAL_size_t(n + 1, harena.size);
 }
 
 /*! @} */
 
+/*!
+ * \defgroup bump Test item allocation inside the arena blocks
+ * @{
+ */
+
+void test_arena_allocator_api_bump_when_empty_arena_size(void) {
+    (void)prv_arena_allocator_api_bump(&harena, sizeof(int), ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+}
+
+void test_arena_allocator_api_bump_when_empty_block_size(void) {
+    (void)prv_arena_allocator_api_bump(&harena, sizeof(int), ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_size_t(ARENA_ALLOCATOR_BLOCK_SIZE, harena.items[0U].size);
+}
+
+void test_arena_allocator_api_bump_same_block_arena_size(void) {
+    (void)prv_arena_allocator_api_bump(&harena, sizeof(int), ARENA_ALLOCATOR_ALIGNMENT, false);
+    (void)prv_arena_allocator_api_bump(&harena, sizeof(int), ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+}
+
+void test_arena_allocator_api_bump_same_block_address(void) {
+    char *first = (char *)prv_arena_allocator_api_bump(&harena, sizeof(int), ARENA_ALLOCATOR_ALIGNMENT, false);
+    char *second = (char *)prv_arena_allocator_api_bump(&harena, sizeof(int), ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_PTR(first + ARENA_ALLOCATOR_ALIGNMENT, second);
+}
+
+void test_arena_allocator_api_bump_alignment(void) {
+    (void)prv_arena_allocator_api_bump(&harena, 1U, ARENA_ALLOCATOR_ALIGNMENT, false);
+    void *item = prv_arena_allocator_api_bump(&harena, sizeof(double), ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_size_t(0U, (size_t)item % ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+void test_arena_allocator_api_bump_when_full_block_arena_size(void) {
+    (void)prv_arena_allocator_api_bump(&harena, ARENA_ALLOCATOR_BLOCK_SIZE, ARENA_ALLOCATOR_ALIGNMENT, false);
+    (void)prv_arena_allocator_api_bump(&harena, 1U, ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_size_t(2U, harena.size);
+}
+
+void test_arena_allocator_api_bump_when_full_block_address(void) {
+    (void)prv_arena_allocator_api_bump(&harena, ARENA_ALLOCATOR_BLOCK_SIZE, ARENA_ALLOCATOR_ALIGNMENT, false);
+    void *item = prv_arena_allocator_api_bump(&harena, 1U, ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_PTR(harena.items[1U].value, item);
+}
+
+void test_arena_allocator_api_bump_when_bigger_than_block_size(void) {
+    const size_t size = ARENA_ALLOCATOR_BLOCK_SIZE * 2U + 1U;
+    (void)prv_arena_allocator_api_bump(&harena, size, ARENA_ALLOCATOR_ALIGNMENT, false);
+    TEST_ASSERT_EQUAL_size_t(size, harena.items[0U].size);
+}
+
+void test_arena_allocator_api_bump_when_bigger_than_block_size_with_alignment(void) {
+    const size_t size = ARENA_ALLOCATOR_BLOCK_SIZE * 2U;
+    const size_t align = ARENA_ALLOCATOR_ALIGNMENT * 4U;
+    void *item = prv_arena_allocator_api_bump(&harena, size, align, false);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL_size_t(0U, (size_t)item % align);
+}
+
+/*! @} */
+
 /*!
  * \defgroup init Test initialization
  * @{
@@ -129,9 +219,469 @@ void test_arena_allocator_api_init_with_null(void) {
 
 void test_arena_allocator_api_init_values(void) {
     struct ArenaAllocatorHandler expected = { 0 };
+#ifdef ARENA_ALLOCATOR_DEBUG
+    expected.debug = true;
+#endif // ARENA_ALLOCATOR_DEBUG
+    TEST_ASSERT_EQUAL_MEMORY(&expected, &harena, sizeof(expected));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup init_with_config Test initialization with a custom configuration
+ * @{
+ */
+
+void test_arena_allocator_api_init_with_config_with_null_config(void) {
+    struct ArenaAllocatorHandler expected = { 0 };
+#ifdef ARENA_ALLOCATOR_DEBUG
+    expected.debug = true;
+#endif // ARENA_ALLOCATOR_DEBUG
+    arena_allocator_api_init_with_config(&harena, NULL);
     TEST_ASSERT_EQUAL_MEMORY(&expected, &harena, sizeof(expected));
 }
 
+void test_arena_allocator_api_init_with_config_initial_capacity(void) {
+    struct ArenaAllocatorConfig config = { .initial_capacity = 8U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_EQUAL_size_t(8U, harena.capacity);
+}
+
+void test_arena_allocator_api_init_with_config_growth_factor(void) {
+    struct ArenaAllocatorConfig config = { .initial_capacity = 2U, .growth_factor = 3U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i < 3U; ++i)
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    TEST_ASSERT_EQUAL_size_t(6U, harena.capacity);
+}
+
+void test_arena_allocator_api_init_with_config_growth_increment(void) {
+    struct ArenaAllocatorConfig config = { .initial_capacity = 2U, .growth_factor = 3U, .growth_increment = 1U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i < 3U; ++i)
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    TEST_ASSERT_EQUAL_size_t(3U, harena.capacity);
+}
+
+void test_arena_allocator_api_init_with_config_max_capacity(void) {
+    struct ArenaAllocatorConfig config = { .max_capacity = 3U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i < 3U; ++i)
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    TEST_ASSERT_EQUAL_size_t(3U, harena.capacity);
+}
+
+void test_arena_allocator_api_init_with_config_max_capacity_when_full(void) {
+    struct ArenaAllocatorConfig config = { .max_capacity = 1U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, 1U));
+}
+
+void test_arena_allocator_api_init_with_config_block_size(void) {
+    struct ArenaAllocatorConfig config = { .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_EQUAL_size_t(64U, harena.items[0U].size);
+}
+
+void test_arena_allocator_api_reserve_with_null(void) {
+    TEST_ASSERT_FALSE(arena_allocator_api_reserve(NULL, 4U));
+}
+
+void test_arena_allocator_api_reserve_capacity(void) {
+    TEST_ASSERT_TRUE(arena_allocator_api_reserve(&harena, 100U));
+    TEST_ASSERT_EQUAL_size_t(100U, harena.capacity);
+}
+
+void test_arena_allocator_api_reserve_smaller_capacity(void) {
+    (void)arena_allocator_api_reserve(&harena, 100U);
+    TEST_ASSERT_TRUE(arena_allocator_api_reserve(&harena, 10U));
+    TEST_ASSERT_EQUAL_size_t(100U, harena.capacity);
+}
+
+void test_arena_allocator_api_reserve_without_realloc_address(void) {
+    (void)arena_allocator_api_reserve(&harena, 4U);
+    void *expected = harena.items;
+    for (size_t i = 0U; i < 4U; ++i)
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    TEST_ASSERT_EQUAL_PTR(expected, harena.items);
+}
+
+void test_arena_allocator_api_reserve_over_max_capacity(void) {
+    struct ArenaAllocatorConfig config = { .max_capacity = 4U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    TEST_ASSERT_FALSE(arena_allocator_api_reserve(&harena, 5U));
+}
+
+void test_arena_allocator_api_reserve_static(void) {
+    static unsigned char buffer[128U];
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    TEST_ASSERT_FALSE(arena_allocator_api_reserve(&harena, 2U));
+}
+
+void test_arena_allocator_api_chunked_capacity(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i <= ARENA_ALLOCATOR_ITEM_CHUNK_SIZE; ++i)
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    TEST_ASSERT_EQUAL_size_t(ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 2U, harena.capacity);
+    TEST_ASSERT_NULL(harena.items);
+}
+
+void test_arena_allocator_api_chunked_blocks_not_moved(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED };
+    arena_allocator_api_init_with_config(&harena, &config);
+    (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    struct ArenaAllocatorItem *expected = harena.current;
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 3U; ++i)
+        (void)prv_arena_allocator_api_item_push_with_alloc(&harena, sizeof(int), false);
+    TEST_ASSERT_EQUAL_PTR(expected, &harena.chunks->items[0U]);
+}
+
+void test_arena_allocator_api_chunked_alloc_values(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    const size_t count = ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 8U;
+    int *items[ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 8U];
+    for (size_t i = 0U; i < count; ++i) {
+        items[i] = (int *)arena_allocator_api_alloc(&harena, 64U);
+        *items[i] = (int)i;
+    }
+    for (size_t i = 0U; i < count; ++i)
+        TEST_ASSERT_EQUAL_INT((int)i, *items[i]);
+}
+
+void test_arena_allocator_api_chunked_rewind_address(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    void *expected = arena_allocator_api_alloc(&harena, 64U);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 2U; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_PTR(expected, arena_allocator_api_alloc(&harena, 64U));
+}
+
+void test_arena_allocator_api_chunked_reset_reuses_blocks(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    const size_t count = ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 2U;
+    for (size_t i = 0U; i < count; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    arena_allocator_api_reset(&harena);
+    for (size_t i = 0U; i < count; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    TEST_ASSERT_EQUAL_size_t(count, harena.reserved);
+}
+
+void test_arena_allocator_api_chunked_reset_alloc_bigger_than_kept_block(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    void *kept = harena.chunks->items[0U].value;
+    arena_allocator_api_reset(&harena);
+    (void)arena_allocator_api_alloc(&harena, 128U);
+    TEST_ASSERT_EQUAL_PTR(kept, harena.chunks->next->items[0U].value);
+}
+
+void test_arena_allocator_api_chunked_reserve(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED };
+    arena_allocator_api_init_with_config(&harena, &config);
+    TEST_ASSERT_TRUE(arena_allocator_api_reserve(&harena, ARENA_ALLOCATOR_ITEM_CHUNK_SIZE + 1U));
+    TEST_ASSERT_EQUAL_size_t(ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 2U, harena.capacity);
+}
+
+void test_arena_allocator_api_chunked_reserve_rewind_bigger_block(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    (void)arena_allocator_api_reserve(&harena, ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 4U);
+    (void)arena_allocator_api_alloc(&harena, 64U);
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    (void)arena_allocator_api_alloc(&harena, 64U);
+    (void)arena_allocator_api_alloc(&harena, 64U);
+    void *first = harena.chunks->items[1U].value;
+    void *second = harena.chunks->items[2U].value;
+    arena_allocator_api_rewind(&harena, mark);
+    (void)arena_allocator_api_alloc(&harena, 128U);
+    TEST_ASSERT_EQUAL_size_t(4U, harena.reserved);
+    TEST_ASSERT_EQUAL_PTR(second, harena.chunks->items[2U].value);
+    TEST_ASSERT_EQUAL_PTR(first, harena.chunks->items[3U].value);
+}
+
+void test_arena_allocator_api_chunked_spare_follows_reserved(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    (void)arena_allocator_api_reserve(&harena, ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 3U);
+    TEST_ASSERT_EQUAL_PTR(harena.chunks, harena.spare);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    TEST_ASSERT_EQUAL_PTR(harena.chunks->next, harena.spare);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 2U; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    TEST_ASSERT_NULL(harena.spare);
+    (void)arena_allocator_api_alloc(&harena, 64U);
+    TEST_ASSERT_EQUAL_PTR(harena.tail, harena.spare);
+}
+
+void test_arena_allocator_api_chunked_rewind_current(void) {
+    struct ArenaAllocatorConfig config = { .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED, .block_size = 64U };
+    arena_allocator_api_init_with_config(&harena, &config);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE + 1U; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    for (size_t i = 0U; i < ARENA_ALLOCATOR_ITEM_CHUNK_SIZE * 2U; ++i)
+        (void)arena_allocator_api_alloc(&harena, 64U);
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_PTR(&harena.chunks->next->items[0U], harena.current);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup init_static Test initialization over a caller supplied buffer
+ * @{
+ */
+
+#define TEST_STATIC_BUFFER_SIZE (256U)
+static unsigned char static_buffer[TEST_STATIC_BUFFER_SIZE];
+
+void test_arena_allocator_api_init_static_with_null(void) {
+    arena_allocator_api_init_static(NULL, static_buffer, sizeof(static_buffer));
+    /*!
+     * The assertion is always true since, if not handled correctly, the init
+     * function should crash given NULL as parameter even if it is not
+     * garanteed to.
+     */
+    TEST_ASSERT_TRUE(1);
+}
+
+void test_arena_allocator_api_init_static_with_null_buffer(void) {
+    arena_allocator_api_init_static(&harena, NULL, sizeof(static_buffer));
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, 1U));
+}
+
+void test_arena_allocator_api_init_static_with_too_small_buffer(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, 1U);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, 1U));
+}
+
+void test_arena_allocator_api_init_static_block_inside_buffer(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    unsigned char *block = (unsigned char *)harena.items[0U].value;
+    TEST_ASSERT_TRUE(block > static_buffer);
+    TEST_ASSERT_EQUAL_PTR(static_buffer + sizeof(static_buffer), block + harena.items[0U].size);
+}
+
+void test_arena_allocator_api_init_static_alloc_address(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    void *item = arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_EQUAL_PTR(harena.items[0U].value, item);
+}
+
+void test_arena_allocator_api_init_static_alloc_when_exhausted(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    (void)arena_allocator_api_alloc(&harena, harena.items[0U].size);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, 1U));
+}
+
+void test_arena_allocator_api_init_static_alloc_when_exhausted_arena_size(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    (void)arena_allocator_api_alloc(&harena, harena.items[0U].size);
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+}
+
+void test_arena_allocator_api_init_static_free_keeps_buffer(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    void *expected = arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL_PTR(expected, arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup init_vm Test initialization over a range of virtual memory
+ * @{
+ */
+
+void test_arena_allocator_api_init_vm_with_null(void) {
+    bool result = arena_allocator_api_init_vm(NULL, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    TEST_ASSERT_FALSE(result);
+}
+
+void test_arena_allocator_api_init_vm_with_zero_size(void) {
+    bool result = arena_allocator_api_init_vm(&harena, 0U);
+    TEST_ASSERT_FALSE(result);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+#if defined(__linux__)
+void test_arena_allocator_api_init_vm_backend(void) {
+    bool result = arena_allocator_api_init_vm(&harena, 4U * ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL(ARENA_ALLOCATOR_BACKEND_VM, harena.backend);
+    TEST_ASSERT_EQUAL(4U * ARENA_ALLOCATOR_VM_COMMIT_SIZE, harena.limit);
+}
+
+void test_arena_allocator_api_init_vm_lazy_commit(void) {
+    (void)arena_allocator_api_init_vm(&harena, 4U * ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    TEST_ASSERT_EQUAL(0U, harena.items[0U].size);
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_EQUAL(ARENA_ALLOCATOR_VM_COMMIT_SIZE, harena.items[0U].size);
+}
+
+void test_arena_allocator_api_init_vm_contiguous(void) {
+    (void)arena_allocator_api_init_vm(&harena, 4U * ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    uint8_t *first = arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    uint8_t *second = arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    TEST_ASSERT_EQUAL_PTR(first + ARENA_ALLOCATOR_VM_COMMIT_SIZE, second);
+    TEST_ASSERT_EQUAL(1U, harena.size);
+    second[ARENA_ALLOCATOR_VM_COMMIT_SIZE - 1U] = 1U;
+}
+
+void test_arena_allocator_api_init_vm_exhausted(void) {
+    (void)arena_allocator_api_init_vm(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    void *item = arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE + 1U);
+    TEST_ASSERT_NULL(item);
+    TEST_ASSERT_FALSE(arena_allocator_api_reserve(&harena, 2U));
+}
+
+void test_arena_allocator_api_init_vm_reset_zeroed(void) {
+    (void)arena_allocator_api_init_vm(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    uint8_t *item = arena_allocator_api_alloc(&harena, 64U);
+    memset(item, 0xFF, 64U);
+    arena_allocator_api_reset(&harena);
+    int *zeroed = arena_allocator_api_calloc(&harena, sizeof(int), 16U);
+    TEST_ASSERT_EQUAL_PTR(item, zeroed);
+    TEST_ASSERT_EACH_EQUAL_INT(0, zeroed, 16U);
+}
+
+void test_arena_allocator_api_init_vm_realloc_in_place(void) {
+    (void)arena_allocator_api_init_vm(&harena, 4U * ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    void *item = arena_allocator_api_alloc(&harena, 64U);
+    void *resized = arena_allocator_api_realloc(&harena, item, 64U, 2U * ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    TEST_ASSERT_EQUAL_PTR(item, resized);
+}
+
+void test_arena_allocator_api_init_vm_with_config_transparent_huge(void) {
+    struct ArenaAllocatorConfig config = { .pages = ARENA_ALLOCATOR_PAGES_TRANSPARENT_HUGE };
+    bool result = arena_allocator_api_init_vm_with_config(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE + 1U, &config);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL(2U * ARENA_ALLOCATOR_VM_COMMIT_SIZE, harena.limit);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)harena.items[0U].value % ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    TEST_ASSERT_NOT_NULL(arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+void test_arena_allocator_api_init_vm_with_config_invalid_numa_node(void) {
+    struct ArenaAllocatorConfig config = { .numa_bind = true, .numa_node = 100000U };
+    bool result = arena_allocator_api_init_vm_with_config(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE, &config);
+    TEST_ASSERT_FALSE(result);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+void test_arena_allocator_api_init_vm_free(void) {
+    (void)arena_allocator_api_init_vm(&harena, ARENA_ALLOCATOR_VM_COMMIT_SIZE);
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_NULL(harena.items);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+#endif // __linux__
+
+/*! @} */
+
+/*!
+ * \defgroup init_child Test initialization of an arena nested in another one
+ * @{
+ */
+
+void test_arena_allocator_api_init_child_with_null_parent(void) {
+    struct ArenaAllocatorHandler hchild;
+    arena_allocator_api_init_child(&hchild, NULL);
+    TEST_ASSERT_NULL(arena_allocator_api_alloc(&hchild, sizeof(int)));
+}
+
+void test_arena_allocator_api_init_child_backend(void) {
+    struct ArenaAllocatorHandler hchild;
+    arena_allocator_api_init_child(&hchild, &harena);
+    TEST_ASSERT_EQUAL(ARENA_ALLOCATOR_BACKEND_CHILD, hchild.backend);
+    TEST_ASSERT_EQUAL_PTR(&harena, hchild.parent);
+}
+
+void test_arena_allocator_api_init_child_alloc_from_parent(void) {
+    struct ArenaAllocatorHandler hchild;
+    arena_allocator_api_init_child(&hchild, &harena);
+    uint8_t *item = arena_allocator_api_alloc(&hchild, sizeof(int));
+    uint8_t *block = harena.items[0U].value;
+    TEST_ASSERT_EQUAL(1U, harena.size);
+    TEST_ASSERT_TRUE(item >= block && item < block + harena.offset);
+    arena_allocator_api_free(&hchild);
+}
+
+void test_arena_allocator_api_init_child_free_gives_back(void) {
+    struct ArenaAllocatorHandler hchild;
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    arena_allocator_api_init_child(&hchild, &harena);
+    for (size_t i = 0U; i < 64U; ++i) {
+        (void)arena_allocator_api_alloc(&hchild, 100U);
+    }
+    arena_allocator_api_free(&hchild);
+    TEST_ASSERT_EQUAL(1U, harena.size);
+    TEST_ASSERT_EQUAL(16U, harena.offset);
+}
+
+void test_arena_allocator_api_init_child_free_interleaved(void) {
+    struct ArenaAllocatorHandler hchild;
+    arena_allocator_api_init_child(&hchild, &harena);
+    (void)arena_allocator_api_alloc(&hchild, 16U);
+    void *item = arena_allocator_api_alloc(&harena, 16U);
+    const size_t offset = harena.offset;
+    arena_allocator_api_free(&hchild);
+    TEST_ASSERT_EQUAL(offset, harena.offset);
+    TEST_ASSERT_EQUAL_PTR(item, (uint8_t *)harena.items[0U].value + offset - 16U);
+}
+
+void test_arena_allocator_api_init_child_reset_keeps_blocks(void) {
+    struct ArenaAllocatorHandler hchild;
+    arena_allocator_api_init_child(&hchild, &harena);
+    void *item = arena_allocator_api_alloc(&hchild, 16U);
+    const size_t offset = harena.offset;
+    arena_allocator_api_reset(&hchild);
+    void *reused = arena_allocator_api_alloc(&hchild, 16U);
+    TEST_ASSERT_EQUAL_PTR(item, reused);
+    TEST_ASSERT_EQUAL(offset, harena.offset);
+    arena_allocator_api_free(&hchild);
+}
+
+void test_arena_allocator_api_init_child_big_item(void) {
+    struct ArenaAllocatorHandler hchild;
+    arena_allocator_api_init_child(&hchild, &harena);
+    void *item = arena_allocator_api_alloc(&hchild, 2U * ARENA_ALLOCATOR_CHILD_BLOCK_SIZE);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL(2U * ARENA_ALLOCATOR_CHILD_BLOCK_SIZE, hchild.current->size);
+    arena_allocator_api_free(&hchild);
+}
+
+void test_arena_allocator_api_init_child_nested(void) {
+    struct ArenaAllocatorHandler hchild;
+    struct ArenaAllocatorHandler hgrandchild;
+    arena_allocator_api_init_child(&hchild, &harena);
+    arena_allocator_api_init_child(&hgrandchild, &hchild);
+    for (size_t i = 0U; i < 64U; ++i) {
+        TEST_ASSERT_NOT_NULL(arena_allocator_api_alloc(&hgrandchild, 100U));
+    }
+    arena_allocator_api_free(&hgrandchild);
+    TEST_ASSERT_EQUAL(0U, hchild.offset);
+    arena_allocator_api_free(&hchild);
+    TEST_ASSERT_EQUAL(0U, harena.offset);
+}
+
 /*! @} */
 
 /*!
@@ -170,6 +720,103 @@ void test_arena_allocator_api_alloc_value(void) {
 
 /*! @} */
 
+/*!
+ * \defgroup alloc_aligned Test allocation of a single aligned item
+ * @{
+ */
+
+void test_arena_allocator_api_alloc_aligned_with_null(void) {
+    void *item = arena_allocator_api_alloc_aligned(NULL, sizeof(int), 64U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_alloc_aligned_with_zero_size(void) {
+    void *item = arena_allocator_api_alloc_aligned(&harena, 0U, 64U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_alloc_aligned_with_zero_alignment(void) {
+    void *item = arena_allocator_api_alloc_aligned(&harena, sizeof(int), 0U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_alloc_aligned_with_non_power_of_two_alignment(void) {
+    void *item = arena_allocator_api_alloc_aligned(&harena, sizeof(int), 48U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_alloc_aligned_address(void) {
+    const size_t align = 64U;
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    void *item = arena_allocator_api_alloc_aligned(&harena, sizeof(int), align);
+    TEST_ASSERT_EQUAL_size_t(0U, (size_t)item % align);
+}
+
+void test_arena_allocator_api_alloc_aligned_same_block(void) {
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    (void)arena_allocator_api_alloc_aligned(&harena, sizeof(int), 64U);
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+}
+
+void test_arena_allocator_api_alloc_aligned_small_alignment_packs_items(void) {
+    char *first = (char *)arena_allocator_api_alloc_aligned(&harena, 1U, 1U);
+    char *second = (char *)arena_allocator_api_alloc_aligned(&harena, 1U, 1U);
+    TEST_ASSERT_EQUAL_PTR(first + 1U, second);
+}
+
+void test_arena_allocator_api_calloc_aligned_address(void) {
+    const size_t align = 32U;
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    void *item = arena_allocator_api_calloc_aligned(&harena, sizeof(float), 8U, align);
+    TEST_ASSERT_EQUAL_size_t(0U, (size_t)item % align);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup typed Test typed allocation
+ * @{
+ */
+
+void test_arena_allocator_api_new_with_null(void) {
+    int *item = ARENA_NEW(NULL, int);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_new_type_alignment(void) {
+    char *c = ARENA_NEW(&harena, char);
+    double *d = ARENA_NEW(&harena, double);
+    TEST_ASSERT_NOT_NULL(c);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)d % _Alignof(double));
+    TEST_ASSERT_EQUAL_PTR(c + _Alignof(double), d);
+}
+
+void test_arena_allocator_api_new_packed(void) {
+    char *first = ARENA_NEW(&harena, char);
+    char *second = ARENA_NEW(&harena, char);
+    TEST_ASSERT_EQUAL_PTR(first + 1U, second);
+}
+
+void test_arena_allocator_api_new_when_full_block(void) {
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE - 1U);
+    int *item = ARENA_NEW(&harena, int);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL(2U, harena.size);
+}
+
+void test_arena_allocator_api_new_array_with_overflow(void) {
+    int *items = ARENA_NEW_ARRAY(&harena, int, SIZE_MAX / sizeof(int) + 1U);
+    TEST_ASSERT_NULL(items);
+}
+
+void test_arena_allocator_api_new_array_size(void) {
+    int *items = ARENA_NEW_ARRAY(&harena, int, 10U);
+    TEST_ASSERT_NOT_NULL(items);
+    TEST_ASSERT_EQUAL(10U * sizeof(int), harena.offset);
+}
+
+/*! @} */
+
 /*!
  * \defgroup calloc Test allocation of multiple items
  * @{
@@ -224,6 +871,52 @@ void test_arena_allocator_api_calloc_with_null_and_zero_size_and_zero_count(void
     TEST_ASSERT_NULL(item);
 }
 
+void test_arena_allocator_api_calloc_with_overflow(void) {
+    const size_t size = SIZE_MAX / 2U + 1U;
+    const size_t count = 2U;
+    void *item = arena_allocator_api_calloc(&harena, size, count);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_calloc_zeroed(void) {
+    const size_t count = 16U;
+    int *item = (int *)arena_allocator_api_calloc(&harena, sizeof(*item), count);
+    TEST_ASSERT_EACH_EQUAL_INT(0, item, count);
+}
+
+void test_arena_allocator_api_calloc_zeroed_when_reused(void) {
+    const size_t count = 16U;
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    int *dirty = (int *)arena_allocator_api_alloc(&harena, sizeof(*dirty) * count);
+    memset(dirty, 0xFF, sizeof(*dirty) * count);
+    arena_allocator_api_rewind(&harena, mark);
+    int *item = (int *)arena_allocator_api_calloc(&harena, sizeof(*item), count);
+    TEST_ASSERT_EACH_EQUAL_INT(0, item, count);
+}
+
+void test_arena_allocator_api_calloc_zeroed_when_reset(void) {
+    const size_t count = 16U;
+    int *dirty = (int *)arena_allocator_api_alloc(&harena, sizeof(*dirty) * count);
+    memset(dirty, 0xFF, sizeof(*dirty) * count);
+    arena_allocator_api_reset(&harena);
+    int *item = (int *)arena_allocator_api_calloc(&harena, sizeof(*item), count);
+    TEST_ASSERT_EACH_EQUAL_INT(0, item, count);
+}
+
+void test_arena_allocator_api_calloc_zeroed_when_static(void) {
+    static unsigned char buffer[128U];
+    memset(buffer, 0xFF, sizeof(buffer));
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    const size_t count = 4U;
+    int *item = (int *)arena_allocator_api_calloc(&harena, sizeof(*item), count);
+    TEST_ASSERT_EACH_EQUAL_INT(0, item, count);
+}
+
+void test_arena_allocator_api_calloc_fresh_block_clean(void) {
+    (void)arena_allocator_api_calloc(&harena, sizeof(int), 4U);
+    TEST_ASSERT_EQUAL_size_t(harena.offset, harena.clean);
+}
+
 void test_arena_allocator_api_calloc_address(void) {
     const size_t count = 3U;
     int *item = (int *)arena_allocator_api_calloc(&harena, sizeof(item), count);
@@ -241,32 +934,610 @@ void test_arena_allocator_api_calloc_values(void) {
 /*! @} */
 
 /*!
- * \defgroup free Test deallocation
+ * \defgroup alloc_batch Test allocation of a batch of items
  * @{
  */
 
-void test_arena_allocator_api_free_with_null(void) {
-    arena_allocator_api_free(NULL);
-    /*!
-     * The assertion is always true since passing NULL as parameter to the free
-     * function sohuld not do anything.
-     */
-    TEST_ASSERT_TRUE(1);
+void test_arena_allocator_api_alloc_batch_with_null(void) {
+    const size_t sizes[] = { 4U, 8U };
+    void *items[2U];
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(NULL, sizes, 2U, items));
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(&harena, NULL, 2U, items));
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(&harena, sizes, 2U, NULL));
 }
 
-void test_arena_allocator_api_free_with_null_arena(void) {
-    arena_allocator_api_free(&harena);
-    /*!
-     * The assertion is always true since deallocating a non existing arena
-     * should do nothing
-     */
-    TEST_ASSERT_TRUE(1);
+void test_arena_allocator_api_alloc_batch_with_zero_count(void) {
+    const size_t sizes[] = { 4U };
+    void *items[1U];
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(&harena, sizes, 0U, items));
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
 }
 
-void test_arena_allocator_api_free_with_null_item(void) {
-    int *ptr = (int *)arena_allocator_api_alloc(&harena, sizeof(int));
-    free(ptr);
-    harena.items[0].value = NULL;
+void test_arena_allocator_api_alloc_batch_with_zero_size(void) {
+    const size_t sizes[] = { 4U, 0U, 8U };
+    void *items[3U] = { NULL, NULL, NULL };
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(&harena, sizes, 3U, items));
+    TEST_ASSERT_NULL(items[0U]);
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_alloc_batch_with_overflow(void) {
+    const size_t sizes[] = { SIZE_MAX / 2U, SIZE_MAX / 2U };
+    void *items[2U];
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(&harena, sizes, 2U, items));
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_alloc_batch_address(void) {
+    const size_t sizes[] = { 1U, ARENA_ALLOCATOR_ALIGNMENT + 1U, 8U };
+    void *items[3U];
+    TEST_ASSERT_TRUE(arena_allocator_api_alloc_batch(&harena, sizes, 3U, items));
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)items[0U] + ARENA_ALLOCATOR_ALIGNMENT, items[1U]);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)items[1U] + 2U * ARENA_ALLOCATOR_ALIGNMENT, items[2U]);
+    for (size_t i = 0U; i < 3U; ++i) {
+        TEST_ASSERT_EQUAL_size_t(0U, (uintptr_t)items[i] % ARENA_ALLOCATOR_ALIGNMENT);
+    }
+}
+
+void test_arena_allocator_api_alloc_batch_single_block(void) {
+    size_t sizes[64U];
+    void *items[64U];
+    for (size_t i = 0U; i < 64U; ++i) {
+        sizes[i] = i % 7U + 1U;
+    }
+    TEST_ASSERT_TRUE(arena_allocator_api_alloc_batch(&harena, sizes, 64U, items));
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+    for (size_t i = 0U; i < 64U; ++i) {
+        memset(items[i], (int)i, sizes[i]);
+    }
+    for (size_t i = 0U; i < 64U; ++i) {
+        TEST_ASSERT_EACH_EQUAL_UINT8((uint8_t)i, items[i], sizes[i]);
+    }
+}
+
+void test_arena_allocator_api_alloc_batch_bigger_than_block_size(void) {
+    const size_t sizes[] = { ARENA_ALLOCATOR_BLOCK_SIZE, ARENA_ALLOCATOR_BLOCK_SIZE };
+    void *items[2U];
+    TEST_ASSERT_TRUE(arena_allocator_api_alloc_batch(&harena, sizes, 2U, items));
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)items[0U] + ARENA_ALLOCATOR_BLOCK_SIZE, items[1U]);
+}
+
+void test_arena_allocator_api_alloc_batch_when_exhausted(void) {
+    static uint8_t buffer[256U];
+    struct ArenaAllocatorHandler hstatic;
+    arena_allocator_api_init_static(&hstatic, buffer, sizeof(buffer));
+    const size_t sizes[] = { 8U, sizeof(buffer) };
+    void *items[2U] = { NULL, NULL };
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_batch(&hstatic, sizes, 2U, items));
+    TEST_ASSERT_NULL(items[0U]);
+    TEST_ASSERT_EQUAL_size_t(0U, hstatic.offset);
+    arena_allocator_api_free(&hstatic);
+}
+
+void test_arena_allocator_api_alloc_n_with_null(void) {
+    void *items[2U];
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_n(NULL, 4U, 2U, items));
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_n(&harena, 4U, 2U, NULL));
+}
+
+void test_arena_allocator_api_alloc_n_with_zero_size(void) {
+    void *items[2U];
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_n(&harena, 0U, 2U, items));
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_n(&harena, 4U, 0U, items));
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_alloc_n_with_overflow(void) {
+    void *items[2U];
+    TEST_ASSERT_FALSE(arena_allocator_api_alloc_n(&harena, SIZE_MAX / 2U, 4U, items));
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_alloc_n_address(void) {
+    void *items[16U];
+    TEST_ASSERT_TRUE(arena_allocator_api_alloc_n(&harena, 3U, 16U, items));
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+    for (size_t i = 1U; i < 16U; ++i) {
+        TEST_ASSERT_EQUAL_PTR((uint8_t *)items[i - 1U] + ARENA_ALLOCATOR_ALIGNMENT, items[i]);
+    }
+}
+
+/*! @} */
+
+/*!
+ * \defgroup offset Test allocation of items referenced by offset
+ * @{
+ */
+
+/*! Node of a list linked by offsets */
+struct OffsetNode {
+    uint32_t next; /*!< The offset of the next node, zero for the last one. */
+    int value;     /*!< The value of the node. */
+};
+
+/*! Buffer used by the arenas supporting offsets */
+static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) uint8_t offset_buffer[1024U];
+
+void test_arena_allocator_api_alloc_offset_with_null(void) {
+    TEST_ASSERT_EQUAL_UINT32(0U, arena_allocator_api_alloc_offset(NULL, sizeof(int)));
+}
+
+void test_arena_allocator_api_alloc_offset_with_zero_size(void) {
+    struct ArenaAllocatorHandler hstatic;
+    arena_allocator_api_init_static(&hstatic, offset_buffer, sizeof(offset_buffer));
+    TEST_ASSERT_EQUAL_UINT32(0U, arena_allocator_api_alloc_offset(&hstatic, 0U));
+    arena_allocator_api_free(&hstatic);
+}
+
+void test_arena_allocator_api_alloc_offset_when_heap(void) {
+    TEST_ASSERT_EQUAL_UINT32(0U, arena_allocator_api_alloc_offset(&harena, sizeof(int)));
+}
+
+void test_arena_allocator_api_alloc_offset_resolve(void) {
+    struct ArenaAllocatorHandler hstatic;
+    arena_allocator_api_init_static(&hstatic, offset_buffer, sizeof(offset_buffer));
+    const uint32_t first = arena_allocator_api_alloc_offset(&hstatic, sizeof(int));
+    const uint32_t second = arena_allocator_api_alloc_offset(&hstatic, sizeof(int));
+    TEST_ASSERT_NOT_EQUAL(0U, first);
+    TEST_ASSERT_NOT_EQUAL(first, second);
+    int *item = ARENA_RESOLVE(&hstatic, int, second);
+    TEST_ASSERT_EQUAL_PTR(item, arena_allocator_api_resolve(&hstatic, second));
+    TEST_ASSERT_EQUAL_UINT32(second, arena_allocator_api_offset(&hstatic, item));
+    TEST_ASSERT_NULL(arena_allocator_api_resolve(&hstatic, 0U));
+    arena_allocator_api_free(&hstatic);
+}
+
+void test_arena_allocator_api_alloc_offset_aligned(void) {
+    struct ArenaAllocatorHandler hstatic;
+    arena_allocator_api_init_static(&hstatic, offset_buffer, sizeof(offset_buffer));
+    (void)arena_allocator_api_alloc_offset(&hstatic, 1U);
+    const uint32_t offset = arena_allocator_api_alloc_offset_aligned(&hstatic, 8U, 64U);
+    TEST_ASSERT_NOT_EQUAL(0U, offset);
+    TEST_ASSERT_EQUAL_size_t(0U, (uintptr_t)arena_allocator_api_resolve(&hstatic, offset) % 64U);
+    arena_allocator_api_free(&hstatic);
+}
+
+void test_arena_allocator_api_alloc_offset_when_exhausted(void) {
+    struct ArenaAllocatorHandler hstatic;
+    arena_allocator_api_init_static(&hstatic, offset_buffer, sizeof(offset_buffer));
+    TEST_ASSERT_EQUAL_UINT32(0U, arena_allocator_api_alloc_offset(&hstatic, sizeof(offset_buffer)));
+    arena_allocator_api_free(&hstatic);
+}
+
+void test_arena_allocator_api_offset_outside_arena(void) {
+    struct ArenaAllocatorHandler hstatic;
+    int value = 0;
+    arena_allocator_api_init_static(&hstatic, offset_buffer, sizeof(offset_buffer));
+    (void)arena_allocator_api_alloc_offset(&hstatic, sizeof(int));
+    TEST_ASSERT_EQUAL_UINT32(0U, arena_allocator_api_offset(&hstatic, &value));
+    TEST_ASSERT_EQUAL_UINT32(0U, arena_allocator_api_offset(&hstatic, NULL));
+    arena_allocator_api_free(&hstatic);
+}
+
+/*! The guard bytes copied with the items are not accessible when the library is built with ASan */
+#if !defined(ARENA_ALLOCATOR_DEBUG) || !defined(__SANITIZE_ADDRESS__)
+void test_arena_allocator_api_alloc_offset_relocatable(void) {
+    struct ArenaAllocatorHandler hstatic;
+    static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) uint8_t copy[sizeof(offset_buffer)];
+    arena_allocator_api_init_static(&hstatic, offset_buffer, sizeof(offset_buffer));
+    uint32_t head = 0U;
+    for (int i = 0; i < 8; ++i) {
+        const uint32_t offset = arena_allocator_api_alloc_offset_aligned(&hstatic, sizeof(struct OffsetNode), _Alignof(struct OffsetNode));
+        struct OffsetNode *node = ARENA_RESOLVE(&hstatic, struct OffsetNode, offset);
+        node->next = head;
+        node->value = i;
+        head = offset;
+    }
+    /*! The content of the arena is moved to another buffer */
+    memcpy(copy, offset_buffer, sizeof(copy));
+    struct ArenaAllocatorHandler hcopy;
+    arena_allocator_api_init_static(&hcopy, copy, sizeof(copy));
+    hcopy.offset = hstatic.offset;
+    arena_allocator_api_free(&hstatic);
+    memset(offset_buffer, 0, sizeof(offset_buffer));
+    int expected = 7;
+    for (uint32_t offset = head; offset != 0U; offset = ARENA_RESOLVE(&hcopy, struct OffsetNode, offset)->next) {
+        TEST_ASSERT_EQUAL_INT(expected, ARENA_RESOLVE(&hcopy, struct OffsetNode, offset)->value);
+        --expected;
+    }
+    TEST_ASSERT_EQUAL_INT(-1, expected);
+    arena_allocator_api_free(&hcopy);
+}
+#endif // ARENA_ALLOCATOR_DEBUG
+
+#if defined(__linux__)
+void test_arena_allocator_api_alloc_offset_when_vm(void) {
+    struct ArenaAllocatorHandler hvm;
+    TEST_ASSERT_TRUE(arena_allocator_api_init_vm(&hvm, (size_t)1U << 30U));
+    const uint32_t offset = arena_allocator_api_alloc_offset(&hvm, ARENA_ALLOCATOR_VM_COMMIT_SIZE * 2U);
+    TEST_ASSERT_NOT_EQUAL(0U, offset);
+    memset(arena_allocator_api_resolve(&hvm, offset), 0xFF, ARENA_ALLOCATOR_VM_COMMIT_SIZE * 2U);
+    arena_allocator_api_free(&hvm);
+}
+#endif // __linux__
+
+/*! @} */
+
+/*!
+ * \defgroup realloc Test resize of an item
+ * @{
+ */
+
+void test_arena_allocator_api_realloc_with_null(void) {
+    void *item = arena_allocator_api_realloc(NULL, NULL, 0U, sizeof(int));
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_realloc_with_null_item(void) {
+    void *item = arena_allocator_api_realloc(&harena, NULL, 0U, sizeof(int));
+    TEST_ASSERT_NOT_NULL(item);
+}
+
+void test_arena_allocator_api_realloc_with_zero_size(void) {
+    void *item = arena_allocator_api_alloc(&harena, sizeof(int));
+    void *resized = arena_allocator_api_realloc(&harena, item, sizeof(int), 0U);
+    TEST_ASSERT_NULL(resized);
+}
+
+void test_arena_allocator_api_realloc_grow_in_place(void) {
+    void *item = arena_allocator_api_alloc(&harena, 8U);
+    void *resized = arena_allocator_api_realloc(&harena, item, 8U, 64U);
+    TEST_ASSERT_EQUAL_PTR(item, resized);
+    TEST_ASSERT_EQUAL(64U, harena.offset);
+}
+
+void test_arena_allocator_api_realloc_shrink_in_place(void) {
+    void *item = arena_allocator_api_alloc(&harena, 64U);
+    void *resized = arena_allocator_api_realloc(&harena, item, 64U, 8U);
+    TEST_ASSERT_EQUAL_PTR(item, resized);
+    TEST_ASSERT_EQUAL(8U, harena.offset);
+}
+
+void test_arena_allocator_api_realloc_not_last_copy(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 4U);
+    memcpy(item, "abc", 4U);
+    (void)arena_allocator_api_alloc(&harena, 4U);
+    uint8_t *resized = arena_allocator_api_realloc(&harena, item, 4U, 32U);
+    TEST_ASSERT_NOT_EQUAL(item, resized);
+    TEST_ASSERT_EQUAL_STRING("abc", (char *)resized);
+}
+
+void test_arena_allocator_api_realloc_not_last_shrink(void) {
+    void *item = arena_allocator_api_alloc(&harena, 32U);
+    (void)arena_allocator_api_alloc(&harena, 4U);
+    void *resized = arena_allocator_api_realloc(&harena, item, 32U, 4U);
+    TEST_ASSERT_EQUAL_PTR(item, resized);
+}
+
+void test_arena_allocator_api_realloc_when_full_block(void) {
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    uint8_t *item = arena_allocator_api_alloc(&harena, 16U);
+    memset(item, 0xA5, 16U);
+    uint8_t *resized = arena_allocator_api_realloc(&harena, item, 16U, ARENA_ALLOCATOR_BLOCK_SIZE);
+    TEST_ASSERT_NOT_NULL(resized);
+    TEST_ASSERT_EQUAL(2U, harena.size);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xA5, resized, 16U);
+}
+
+void test_arena_allocator_api_realloc_growing_buffer(void) {
+    uint32_t *samples = NULL;
+    for (uint32_t i = 0U; i < 256U; ++i) {
+        samples = arena_allocator_api_realloc(&harena, samples, i * sizeof(*samples), (i + 1U) * sizeof(*samples));
+        samples[i] = i;
+    }
+    TEST_ASSERT_EQUAL(1U, harena.size);
+    TEST_ASSERT_EQUAL(256U * sizeof(*samples), harena.offset);
+    TEST_ASSERT_EQUAL(255U, samples[255U]);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup dtor Test cleanup callbacks
+ * @{
+ */
+
+/*! Values of the items cleaned up by the callback in order */
+static int dtor_calls[8U];
+/*! Number of times the callback was called */
+static size_t dtor_count;
+
+/*!
+ * \brief Cleanup callback saving the value of the item.
+ *
+ * \param[in] item A reference to an integer item.
+ */
+static void dtor_record(void *item) {
+    if (dtor_count < sizeof(dtor_calls) / sizeof(*dtor_calls)) {
+        dtor_calls[dtor_count] = *(int *)item;
+    }
+    ++dtor_count;
+}
+
+void test_arena_allocator_api_alloc_with_dtor_with_null(void) {
+    void *item = arena_allocator_api_alloc_with_dtor(NULL, sizeof(int), dtor_record);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_alloc_with_dtor_without_dtor(void) {
+    dtor_count = 0U;
+    int *item = arena_allocator_api_alloc_with_dtor(&harena, sizeof(int), NULL);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_NULL(harena.dtors);
+}
+
+void test_arena_allocator_api_alloc_with_dtor_free_reverse_order(void) {
+    dtor_count = 0U;
+    for (int i = 0; i < 3; ++i) {
+        int *item = arena_allocator_api_alloc_with_dtor(&harena, sizeof(int), dtor_record);
+        *item = i;
+    }
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL(3U, dtor_count);
+    TEST_ASSERT_EQUAL(2, dtor_calls[0U]);
+    TEST_ASSERT_EQUAL(1, dtor_calls[1U]);
+    TEST_ASSERT_EQUAL(0, dtor_calls[2U]);
+}
+
+void test_arena_allocator_api_alloc_with_dtor_rewind(void) {
+    dtor_count = 0U;
+    int *first = arena_allocator_api_alloc_with_dtor(&harena, sizeof(int), dtor_record);
+    *first = 1;
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    int *second = arena_allocator_api_alloc_with_dtor(&harena, sizeof(int), dtor_record);
+    *second = 2;
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL(1U, dtor_count);
+    TEST_ASSERT_EQUAL(2, dtor_calls[0U]);
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL(2U, dtor_count);
+}
+
+void test_arena_allocator_api_alloc_with_dtor_reset(void) {
+    dtor_count = 0U;
+    int *item = arena_allocator_api_alloc_with_dtor(&harena, sizeof(int), dtor_record);
+    *item = 1;
+    arena_allocator_api_reset(&harena);
+    TEST_ASSERT_EQUAL(1U, dtor_count);
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL(1U, dtor_count);
+}
+
+void test_arena_allocator_api_alloc_with_dtor_exhausted_static(void) {
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    const size_t offset = harena.offset;
+    void *item = arena_allocator_api_alloc_with_dtor(&harena, harena.items[0U].size, dtor_record);
+    TEST_ASSERT_NULL(item);
+    TEST_ASSERT_NULL(harena.dtors);
+    TEST_ASSERT_EQUAL_size_t(offset, harena.offset);
+}
+
+void test_arena_allocator_api_on_free_with_null_dtor(void) {
+    int value = 0;
+    bool result = arena_allocator_api_on_free(&harena, &value, NULL);
+    TEST_ASSERT_FALSE(result);
+}
+
+void test_arena_allocator_api_on_free_external_item(void) {
+    static int value = 7;
+    dtor_count = 0U;
+    bool result = arena_allocator_api_on_free(&harena, &value, dtor_record);
+    TEST_ASSERT_TRUE(result);
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL(1U, dtor_count);
+    TEST_ASSERT_EQUAL(7, dtor_calls[0U]);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup mark Test save points
+ * @{
+ */
+
+void test_arena_allocator_api_mark_with_null(void) {
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(NULL);
+    TEST_ASSERT_EQUAL_size_t(0U, mark.size);
+    TEST_ASSERT_EQUAL_size_t(0U, mark.offset);
+}
+
+void test_arena_allocator_api_mark_values(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    TEST_ASSERT_EQUAL_size_t(harena.size, mark.size);
+    TEST_ASSERT_EQUAL_size_t(harena.offset, mark.offset);
+}
+
+void test_arena_allocator_api_rewind_with_null(void) {
+    struct ArenaAllocatorMark mark = { 0 };
+    arena_allocator_api_rewind(NULL, mark);
+    /*!
+     * The assertion is always true since passing NULL as parameter to the
+     * rewind function should not do anything.
+     */
+    TEST_ASSERT_TRUE(1);
+}
+
+void test_arena_allocator_api_rewind_same_block_address(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    void *expected = arena_allocator_api_alloc(&harena, sizeof(int));
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_PTR(expected, arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+void test_arena_allocator_api_rewind_keeps_previous_items(void) {
+    int *item = (int *)arena_allocator_api_alloc(&harena, sizeof(int));
+    *item = 10;
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    int *other = (int *)arena_allocator_api_alloc(&harena, sizeof(int));
+    *other = 20;
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_INT(10, *item);
+}
+
+void test_arena_allocator_api_rewind_releases_later_blocks(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_size_t(1U, harena.size);
+}
+
+void test_arena_allocator_api_rewind_keeps_later_blocks(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    void *expected = arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    arena_allocator_api_rewind(&harena, mark);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    TEST_ASSERT_EQUAL_PTR(expected, arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE));
+}
+
+void test_arena_allocator_api_rewind_to_empty_arena(void) {
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_rewind_with_invalid_mark(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    struct ArenaAllocatorMark outer = arena_allocator_api_mark(&harena);
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    struct ArenaAllocatorMark inner = arena_allocator_api_mark(&harena);
+    arena_allocator_api_rewind(&harena, outer);
+    arena_allocator_api_rewind(&harena, inner);
+    TEST_ASSERT_EQUAL_size_t(outer.offset, harena.offset);
+}
+
+void test_arena_allocator_api_rewind_static(void) {
+    static unsigned char buffer[128U];
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    void *expected = arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EQUAL_PTR(expected, arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+/*! @} */
+
+/*!
+ * \defgroup reset Test release without deallocation
+ * @{
+ */
+
+void test_arena_allocator_api_reset_with_null(void) {
+    arena_allocator_api_reset(NULL);
+    /*!
+     * The assertion is always true since passing NULL as parameter to the
+     * reset function should not do anything.
+     */
+    TEST_ASSERT_TRUE(1);
+}
+
+void test_arena_allocator_api_reset_size(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_reset(&harena);
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_reset_keeps_blocks(void) {
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    const size_t capacity = harena.capacity;
+    arena_allocator_api_reset(&harena);
+    TEST_ASSERT_EQUAL_size_t(2U, harena.reserved);
+    TEST_ASSERT_EQUAL_size_t(capacity, harena.capacity);
+}
+
+void test_arena_allocator_api_reset_alloc_address(void) {
+    void *expected = arena_allocator_api_alloc(&harena, sizeof(int));
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_reset(&harena);
+    TEST_ASSERT_EQUAL_PTR(expected, arena_allocator_api_alloc(&harena, sizeof(int)));
+}
+
+void test_arena_allocator_api_reset_alloc_reuses_blocks(void) {
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    arena_allocator_api_reset(&harena);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    TEST_ASSERT_EQUAL_size_t(2U, harena.reserved);
+}
+
+void test_arena_allocator_api_reset_alloc_bigger_than_kept_block(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    void *kept = harena.items[0U].value;
+    arena_allocator_api_reset(&harena);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE * 2U);
+    TEST_ASSERT_EQUAL_size_t(2U, harena.reserved);
+    TEST_ASSERT_EQUAL_PTR(kept, harena.items[1U].value);
+}
+
+void test_arena_allocator_api_reset_loop_stops_allocating(void) {
+    const size_t sizes[] = { 12000U, 100U, 20000U, 3000U, 16000U, 700U, 10000U, 4000U };
+    const size_t count = sizeof(sizes) / sizeof(sizes[0U]);
+    size_t reserved = 0U;
+    for (size_t i = 0U; i < 1000U; ++i) {
+        arena_allocator_api_reset(&harena);
+        /*! Every frame allocates the same items in a different order */
+        for (size_t j = 0U; j < count; ++j)
+            TEST_ASSERT_NOT_NULL(arena_allocator_api_alloc(&harena, sizes[(i * 3U + j * (i % 2U == 0U ? 1U : count - 1U)) % count]));
+        if (i == 0U)
+            reserved = harena.reserved;
+    }
+    TEST_ASSERT_EQUAL_size_t(reserved, harena.reserved);
+}
+
+void test_arena_allocator_api_reset_loop_varying_sizes(void) {
+    uint32_t seed = 1U;
+    size_t reserved = 0U;
+    for (size_t i = 0U; i < 10000U; ++i) {
+        arena_allocator_api_reset(&harena);
+        seed = seed * 1103515245U + 12345U;
+        const size_t size = 10000U + (seed >> 8U) % 10000U;
+        TEST_ASSERT_NOT_NULL(arena_allocator_api_alloc(&harena, size));
+        if (i == 100U)
+            reserved = harena.reserved;
+    }
+    TEST_ASSERT_EQUAL_size_t(reserved, harena.reserved);
+    TEST_ASSERT_LESS_OR_EQUAL_size_t(4U, harena.reserved);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup free Test deallocation
+ * @{
+ */
+
+void test_arena_allocator_api_free_with_null(void) {
+    arena_allocator_api_free(NULL);
+    /*!
+     * The assertion is always true since passing NULL as parameter to the free
+     * function sohuld not do anything.
+     */
+    TEST_ASSERT_TRUE(1);
+}
+
+void test_arena_allocator_api_free_with_null_arena(void) {
+    arena_allocator_api_free(&harena);
+    /*!
+     * The assertion is always true since deallocating a non existing arena
+     * should do nothing
+     */
+    TEST_ASSERT_TRUE(1);
+}
+
+void test_arena_allocator_api_free_with_null_item(void) {
+    int *ptr = (int *)arena_allocator_api_alloc(&harena, sizeof(int));
+    free(ptr);
+    harena.items[0].value = NULL;
     arena_allocator_api_free(&harena);
     /*!
      * The assertion is always true since deallocating a non existing item
@@ -275,23 +1546,1033 @@ void test_arena_allocator_api_free_with_null_item(void) {
     TEST_ASSERT_TRUE(1);
 }
 
-void test_arena_allocator_api_free_size(void) {
-    (void)arena_allocator_api_alloc(&harena, sizeof(int));
-    arena_allocator_api_free(&harena);
-    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+void test_arena_allocator_api_free_size(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL_size_t(0U, harena.size);
+}
+
+void test_arena_allocator_api_free_capacity(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL_size_t(0U, harena.capacity);
+}
+void test_arena_allocator_api_free_after_reset(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_reset(&harena);
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL_size_t(0U, harena.reserved);
+}
+
+void test_arena_allocator_api_free_address(void) {
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_EQUAL_PTR(NULL, harena.items);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup debug Test debug mode checks
+ * @{
+ */
+
+void test_arena_allocator_api_check_with_null(void) {
+    TEST_ASSERT_FALSE(arena_allocator_api_check(NULL));
+}
+
+void test_arena_allocator_api_check_when_empty(void) {
+    TEST_ASSERT_TRUE(arena_allocator_api_check(&harena));
+}
+
+void test_arena_allocator_api_check_after_alloc(void) {
+    for (size_t i = 0U; i < 64U; ++i) {
+        uint8_t *item = arena_allocator_api_alloc(&harena, 24U);
+        memset(item, 0xFF, 24U);
+    }
+    TEST_ASSERT_TRUE(arena_allocator_api_check(&harena));
+}
+
+void test_arena_allocator_api_debug_handler_flag(void) {
+    /*! The flag keeps files compiled without the macro off the inline fast path */
+#ifdef ARENA_ALLOCATOR_DEBUG
+    const bool expected = true;
+#else
+    const bool expected = false;
+#endif // ARENA_ALLOCATOR_DEBUG
+    TEST_ASSERT_EQUAL(expected, harena.debug);
+    arena_allocator_api_init_static(&harena, static_buffer, sizeof(static_buffer));
+    TEST_ASSERT_EQUAL(expected, harena.debug);
+}
+
+/*! The guard bytes are not accessible when the library is built with ASan */
+#if defined(ARENA_ALLOCATOR_DEBUG) && !defined(__SANITIZE_ADDRESS__)
+void test_arena_allocator_api_debug_guard_after_item(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 5U);
+    TEST_ASSERT_EACH_EQUAL_UINT8(ARENA_ALLOCATOR_DEBUG_GUARD_BYTE, item + 5U, ARENA_ALLOCATOR_DEBUG_GUARD_SIZE);
+}
+
+void test_arena_allocator_api_debug_guard_before_item(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 5U);
+    TEST_ASSERT_EQUAL_UINT8(ARENA_ALLOCATOR_DEBUG_GUARD_BYTE, item[-1]);
+}
+
+void test_arena_allocator_api_debug_check_overrun(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 5U);
+    (void)arena_allocator_api_alloc(&harena, 5U);
+    item[5U] = 0U;
+    TEST_ASSERT_FALSE(arena_allocator_api_check(&harena));
+    item[5U] = ARENA_ALLOCATOR_DEBUG_GUARD_BYTE;
+    TEST_ASSERT_TRUE(arena_allocator_api_check(&harena));
+}
+
+void test_arena_allocator_api_debug_check_underrun(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 5U);
+    item[-1] = 0U;
+    TEST_ASSERT_FALSE(arena_allocator_api_check(&harena));
+    item[-1] = ARENA_ALLOCATOR_DEBUG_GUARD_BYTE;
+}
+
+void test_arena_allocator_api_debug_rewind_poison(void) {
+    const struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    uint8_t *item = arena_allocator_api_alloc(&harena, 8U);
+    memset(item, 0U, 8U);
+    arena_allocator_api_rewind(&harena, mark);
+    TEST_ASSERT_EACH_EQUAL_UINT8(ARENA_ALLOCATOR_DEBUG_POISON_BYTE, item, 8U);
+}
+
+void test_arena_allocator_api_debug_reset_poison(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 8U);
+    memset(item, 0U, 8U);
+    arena_allocator_api_reset(&harena);
+    TEST_ASSERT_EACH_EQUAL_UINT8(ARENA_ALLOCATOR_DEBUG_POISON_BYTE, item, 8U);
+}
+
+void test_arena_allocator_api_debug_realloc_keeps_guard(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 4U);
+    item = arena_allocator_api_realloc(&harena, item, 4U, 12U);
+    memset(item, 0xFF, 12U);
+    TEST_ASSERT_TRUE(arena_allocator_api_check(&harena));
+}
+#endif // ARENA_ALLOCATOR_DEBUG
+
+/*! The memory given back by the arena must be accessible again */
+#if defined(ARENA_ALLOCATOR_DEBUG) && defined(__SANITIZE_ADDRESS__)
+void test_arena_allocator_api_debug_free_static_unpoison(void) {
+    static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) unsigned char buffer[256U];
+    arena_allocator_api_free(&harena);
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    (void)arena_allocator_api_alloc(&harena, 8U);
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_NULL(__asan_region_is_poisoned(buffer, sizeof(buffer)));
+}
+
+#if defined(__linux__)
+void test_arena_allocator_api_debug_free_vm_unpoison(void) {
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_TRUE(arena_allocator_api_init_vm(&harena, 4U * ARENA_ALLOCATOR_VM_COMMIT_SIZE));
+    uint8_t *block = harena.items[0U].value;
+    (void)arena_allocator_api_alloc(&harena, 8U);
+    const size_t committed = harena.items[0U].size;
+    arena_allocator_api_free(&harena);
+    TEST_ASSERT_NULL(__asan_region_is_poisoned(block, committed));
+}
+#endif // __linux__
+#endif // ARENA_ALLOCATOR_DEBUG
+
+/*! @} */
+
+/*!
+ * \defgroup stats Test usage statistics
+ * @{
+ */
+
+void test_arena_allocator_api_get_stats_with_null(void) {
+    bool result = arena_allocator_api_get_stats(&harena, NULL);
+    TEST_ASSERT_FALSE(result);
+}
+
+#ifdef ARENA_ALLOCATOR_STATS
+void test_arena_allocator_api_get_stats_with_null_arena(void) {
+    struct ArenaAllocatorStats stats;
+    bool result = arena_allocator_api_get_stats(NULL, &stats);
+    TEST_ASSERT_FALSE(result);
+    TEST_ASSERT_EQUAL(0U, stats.used);
+}
+
+void test_arena_allocator_api_get_stats_after_alloc(void) {
+    struct ArenaAllocatorStats stats;
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    bool result = arena_allocator_api_get_stats(&harena, &stats);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL(2U, stats.requested);
+    TEST_ASSERT_EQUAL(ARENA_ALLOCATOR_ALIGNMENT + 1U, stats.used);
+    TEST_ASSERT_EQUAL(ARENA_ALLOCATOR_BLOCK_SIZE, stats.reserved);
+    TEST_ASSERT_EQUAL(1U, stats.blocks);
+    TEST_ASSERT_EQUAL(1U, stats.growths);
+    TEST_ASSERT_EQUAL(stats.used - stats.requested + harena.capacity * sizeof(struct ArenaAllocatorItem), stats.overhead);
+}
+
+void test_arena_allocator_api_get_stats_peak_after_reset(void) {
+    struct ArenaAllocatorStats stats;
+    (void)arena_allocator_api_alloc(&harena, 64U);
+    arena_allocator_api_reset(&harena);
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    (void)arena_allocator_api_get_stats(&harena, &stats);
+    TEST_ASSERT_EQUAL(16U, stats.used);
+    TEST_ASSERT_EQUAL(64U, stats.peak);
+    TEST_ASSERT_EQUAL(1U, stats.blocks);
+}
+
+void test_arena_allocator_api_get_stats_after_rewind(void) {
+    struct ArenaAllocatorStats stats;
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    struct ArenaAllocatorMark mark = arena_allocator_api_mark(&harena);
+    (void)arena_allocator_api_alloc(&harena, 2U * ARENA_ALLOCATOR_BLOCK_SIZE);
+    arena_allocator_api_rewind(&harena, mark);
+    (void)arena_allocator_api_get_stats(&harena, &stats);
+    TEST_ASSERT_EQUAL(16U, stats.requested);
+    TEST_ASSERT_EQUAL(16U, stats.used);
+    TEST_ASSERT_EQUAL(3U * ARENA_ALLOCATOR_BLOCK_SIZE, stats.reserved);
+    TEST_ASSERT_EQUAL(2U, stats.blocks);
+}
+
+void test_arena_allocator_api_get_stats_after_free(void) {
+    struct ArenaAllocatorStats stats;
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    arena_allocator_api_free(&harena);
+    (void)arena_allocator_api_get_stats(&harena, &stats);
+    TEST_ASSERT_EQUAL(0U, stats.used);
+    TEST_ASSERT_EQUAL(0U, stats.reserved);
+    TEST_ASSERT_EQUAL(0U, stats.overhead);
+    TEST_ASSERT_EQUAL(16U, stats.peak);
+}
+
+void test_arena_allocator_api_get_stats_static(void) {
+    struct ArenaAllocatorStats stats;
+    static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) unsigned char buffer[256U];
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    (void)arena_allocator_api_alloc(&harena, 8U);
+    (void)arena_allocator_api_get_stats(&harena, &stats);
+    TEST_ASSERT_EQUAL(sizeof(buffer) - (size_t)((unsigned char *)harena.items[0U].value - buffer), stats.reserved);
+    TEST_ASSERT_EQUAL(8U, stats.used);
+    TEST_ASSERT_EQUAL(0U, stats.blocks);
+}
+#else
+void test_arena_allocator_api_get_stats_disabled(void) {
+    struct ArenaAllocatorStats stats;
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    bool result = arena_allocator_api_get_stats(&harena, &stats);
+    TEST_ASSERT_FALSE(result);
+    TEST_ASSERT_EQUAL(0U, stats.used);
+}
+#endif // ARENA_ALLOCATOR_STATS
+
+/*! @} */
+
+/*!
+ * \defgroup trace Test allocations traced by call site
+ * @{
+ */
+
+void test_arena_allocator_api_trace_alloc_with_null(void) {
+    void *item = arena_allocator_api_trace_alloc(NULL, 16U, 1U, ARENA_ALLOCATOR_ALIGNMENT, false, "a.c", 1U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_trace_alloc_with_overflow(void) {
+    void *item = arena_allocator_api_trace_alloc(&harena, SIZE_MAX / 2U, 4U, ARENA_ALLOCATOR_ALIGNMENT, false, "a.c", 1U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_api_trace_alloc_zeroed(void) {
+    uint8_t *item = arena_allocator_api_trace_alloc(&harena, 8U, 4U, 64U, true, "a.c", 1U);
+    TEST_ASSERT_NOT_NULL(item);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)item % 64U);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0U, item, 32U);
+}
+
+void test_arena_allocator_api_trace_dump_with_null(void) {
+    bool result = arena_allocator_api_trace_dump(&harena, NULL);
+    TEST_ASSERT_FALSE(result);
+}
+
+#ifdef ARENA_ALLOCATOR_TRACE
+void test_arena_allocator_api_trace_dump_with_null_arena(void) {
+    FILE *file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    bool result = arena_allocator_api_trace_dump(NULL, file);
+    (void)fclose(file);
+    TEST_ASSERT_FALSE(result);
+}
+
+void test_arena_allocator_api_trace_same_site(void) {
+    for (size_t i = 0U; i < 2U; ++i) {
+        (void)arena_allocator_api_alloc(&harena, 16U);
+    }
+    TEST_ASSERT_EQUAL_STRING(__FILE__, harena.trace[0U].file);
+    TEST_ASSERT_EQUAL(2U, harena.trace[0U].count);
+    TEST_ASSERT_EQUAL(32U, harena.trace[0U].bytes);
+    TEST_ASSERT_NULL(harena.trace[1U].file);
+}
+
+void test_arena_allocator_api_trace_different_sites(void) {
+    (void)arena_allocator_api_calloc(&harena, 4U, 4U);
+    (void)ARENA_NEW_ARRAY(&harena, uint64_t, 3U);
+    TEST_ASSERT_EQUAL(1U, harena.trace[0U].count);
+    TEST_ASSERT_EQUAL(16U, harena.trace[0U].bytes);
+    TEST_ASSERT_EQUAL(1U, harena.trace[1U].count);
+    TEST_ASSERT_EQUAL(3U * sizeof(uint64_t), harena.trace[1U].bytes);
+    TEST_ASSERT_EQUAL(harena.trace[0U].line + 1U, harena.trace[1U].line);
+}
+
+/*! Cleanup callback doing nothing */
+static void test_trace_dtor(void *item) {
+    (void)item;
+}
+
+void test_arena_allocator_api_trace_alloc_with_dtor(void) {
+    (void)arena_allocator_api_alloc_with_dtor(&harena, 24U, test_trace_dtor);
+    TEST_ASSERT_TRUE(arena_allocator_api_on_free(&harena, NULL, test_trace_dtor));
+    TEST_ASSERT_EQUAL_STRING(__FILE__, harena.trace[0U].file);
+    TEST_ASSERT_EQUAL(1U, harena.trace[0U].count);
+    TEST_ASSERT_EQUAL(24U, harena.trace[0U].bytes);
+    TEST_ASSERT_NULL(harena.trace[1U].file);
+}
+
+void test_arena_allocator_api_trace_realloc(void) {
+    uint8_t *item = arena_allocator_api_realloc(&harena, NULL, 0U, 8U);
+    item = arena_allocator_api_realloc(&harena, item, 8U, 24U);
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    (void)arena_allocator_api_realloc(&harena, item, 24U, 32U);
+    TEST_ASSERT_EQUAL_STRING(__FILE__, harena.trace[0U].file);
+    TEST_ASSERT_EQUAL(8U, harena.trace[0U].bytes);
+    TEST_ASSERT_EQUAL(harena.trace[0U].line + 1U, harena.trace[1U].line);
+#ifdef ARENA_ALLOCATOR_DEBUG
+    TEST_ASSERT_EQUAL(24U, harena.trace[1U].bytes);
+#else
+    TEST_ASSERT_EQUAL(16U, harena.trace[1U].bytes);
+#endif // ARENA_ALLOCATOR_DEBUG
+    TEST_ASSERT_EQUAL(32U, harena.trace[3U].bytes);
+}
+
+void test_arena_allocator_api_trace_alloc_batch(void) {
+    const size_t sizes[3U] = { 1U, 2U, 3U };
+    void *items[3U];
+    (void)arena_allocator_api_alloc_batch(&harena, sizes, 3U, items);
+    (void)arena_allocator_api_alloc_n(&harena, 4U, 3U, items);
+    TEST_ASSERT_EQUAL(1U, harena.trace[0U].count);
+    TEST_ASSERT_EQUAL(6U, harena.trace[0U].bytes);
+    TEST_ASSERT_EQUAL(1U, harena.trace[1U].count);
+    TEST_ASSERT_EQUAL(12U, harena.trace[1U].bytes);
+}
+
+void test_arena_allocator_api_trace_alloc_offset(void) {
+    static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) unsigned char buffer[256U];
+    arena_allocator_api_free(&harena);
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    (void)arena_allocator_api_alloc_offset(&harena, 8U);
+    (void)arena_allocator_api_alloc_offset_aligned(&harena, 16U, 32U);
+    TEST_ASSERT_EQUAL(8U, harena.trace[0U].bytes);
+    TEST_ASSERT_EQUAL(16U, harena.trace[1U].bytes);
+}
+
+void test_arena_allocator_api_trace_pool_alloc(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *item = arena_allocator_pool_api_alloc(&hpool, ARENA_ALLOCATOR_ALIGNMENT + 1U);
+    arena_allocator_pool_api_free(&hpool, item, ARENA_ALLOCATOR_ALIGNMENT + 1U);
+    (void)arena_allocator_pool_api_alloc(&hpool, ARENA_ALLOCATOR_ALIGNMENT + 1U);
+    TEST_ASSERT_EQUAL_STRING(__FILE__, harena.trace[0U].file);
+    TEST_ASSERT_EQUAL(1U, harena.trace[0U].count);
+    TEST_ASSERT_EQUAL(2U * ARENA_ALLOCATOR_ALIGNMENT, harena.trace[0U].bytes);
+    TEST_ASSERT_NULL(harena.trace[1U].file);
+}
+
+void test_arena_allocator_api_trace_failed_alloc(void) {
+    static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) unsigned char buffer[64U];
+    arena_allocator_api_free(&harena);
+    arena_allocator_api_init_static(&harena, buffer, sizeof(buffer));
+    void *item = arena_allocator_api_alloc(&harena, 2U * sizeof(buffer));
+    TEST_ASSERT_NULL(item);
+    TEST_ASSERT_NULL(harena.trace[0U].file);
+}
+
+void test_arena_allocator_api_trace_sites_overflow(void) {
+    for (unsigned int i = 0U; i < ARENA_ALLOCATOR_TRACE_SITES + 1U; ++i) {
+        (void)arena_allocator_api_trace_alloc(&harena, 1U, 1U, 1U, false, "a.c", i);
+    }
+    TEST_ASSERT_EQUAL(ARENA_ALLOCATOR_TRACE_SITES - 2U, harena.trace[ARENA_ALLOCATOR_TRACE_SITES - 2U].line);
+    TEST_ASSERT_NULL(harena.trace[ARENA_ALLOCATOR_TRACE_SITES - 1U].file);
+    TEST_ASSERT_EQUAL(2U, harena.trace[ARENA_ALLOCATOR_TRACE_SITES - 1U].count);
+}
+
+void test_arena_allocator_api_trace_dump_csv(void) {
+    char content[128U] = { 0 };
+    (void)arena_allocator_api_trace_alloc(&harena, 8U, 1U, ARENA_ALLOCATOR_ALIGNMENT, false, "a.c", 10U);
+    (void)arena_allocator_api_trace_alloc(&harena, 32U, 2U, ARENA_ALLOCATOR_ALIGNMENT, false, "b.c", 20U);
+    (void)arena_allocator_api_trace_alloc(&harena, 8U, 1U, ARENA_ALLOCATOR_ALIGNMENT, false, "a.c", 10U);
+    FILE *file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    bool result = arena_allocator_api_trace_dump(&harena, file);
+    rewind(file);
+    size_t size = fread(content, 1U, sizeof(content) - 1U, file);
+    (void)fclose(file);
+    TEST_ASSERT_TRUE(result);
+    TEST_ASSERT_EQUAL_STRING("file,line,count,bytes\nb.c,20,1,64\na.c,10,2,16\n", content);
+    TEST_ASSERT_EQUAL(strlen(content), size);
+}
+#else
+void test_arena_allocator_api_trace_dump_disabled(void) {
+    FILE *file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    (void)arena_allocator_api_alloc(&harena, 16U);
+    bool result = arena_allocator_api_trace_dump(&harena, file);
+    long size = ftell(file);
+    (void)fclose(file);
+    TEST_ASSERT_FALSE(result);
+    TEST_ASSERT_EQUAL(0, size);
+}
+#endif // ARENA_ALLOCATOR_TRACE
+
+/*! @} */
+
+/*!
+ * \defgroup snapshot Test snapshot of the arena content
+ * @{
+ */
+
+/*! Path of the file used to store the snapshots */
+#define SNAPSHOT_PATH "test-arena-allocator-snapshot.bin"
+
+/*! Node of a list stored inside a snapshot */
+struct SnapshotNode {
+    size_t next; /*!< The offset of the next node, zero for the last one. */
+    int value;   /*!< The value of the node. */
+};
+
+/*! Node of a list stored inside a snapshot of an arena supporting offsets */
+struct HandleNode {
+    uint32_t next; /*!< The offset of the next node returned by the arena, zero for the last one. */
+    int value;     /*!< The value of the node. */
+};
+
+void test_arena_allocator_api_get_block_with_null(void) {
+    struct ArenaAllocatorItem block;
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_FALSE(arena_allocator_api_get_block(NULL, 0U, &block));
+    TEST_ASSERT_FALSE(arena_allocator_api_get_block(&harena, 0U, NULL));
+    TEST_ASSERT_FALSE(arena_allocator_api_get_block(&harena, 1U, &block));
+}
+
+void test_arena_allocator_api_get_block_used_size(void) {
+    struct ArenaAllocatorItem block;
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE / 2U);
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    TEST_ASSERT_TRUE(arena_allocator_api_get_block(&harena, 0U, &block));
+    TEST_ASSERT_EQUAL_PTR(harena.items[0U].value, block.value);
+    TEST_ASSERT_TRUE(block.size >= ARENA_ALLOCATOR_BLOCK_SIZE / 2U && block.size < harena.items[0U].size);
+    TEST_ASSERT_TRUE(arena_allocator_api_get_block(&harena, 1U, &block));
+    TEST_ASSERT_EQUAL_PTR(harena.items[1U].value, block.value);
+    TEST_ASSERT_EQUAL_size_t(harena.offset, block.size);
+}
+
+void test_arena_allocator_snapshot_api_offset_with_null(void) {
+    int *item = arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_EQUAL_size_t(0U, arena_allocator_snapshot_api_offset(NULL, item));
+    TEST_ASSERT_EQUAL_size_t(0U, arena_allocator_snapshot_api_offset(&harena, NULL));
+}
+
+void test_arena_allocator_snapshot_api_offset_outside_arena(void) {
+    int value = 0;
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_EQUAL_size_t(0U, arena_allocator_snapshot_api_offset(&harena, &value));
+}
+
+void test_arena_allocator_snapshot_api_offset_stable(void) {
+    struct ArenaAllocatorConfig config = { .block_size = 256U };
+    arena_allocator_api_free(&harena);
+    arena_allocator_api_init_with_config(&harena, &config);
+    int *first = arena_allocator_api_alloc(&harena, sizeof(int));
+    const size_t offset = arena_allocator_snapshot_api_offset(&harena, first);
+    TEST_ASSERT_NOT_EQUAL(0U, offset);
+    for (size_t i = 0U; i < 64U; ++i) {
+        (void)arena_allocator_api_alloc(&harena, 32U);
+    }
+    TEST_ASSERT_GREATER_THAN_size_t(1U, harena.size);
+    TEST_ASSERT_EQUAL_size_t(offset, arena_allocator_snapshot_api_offset(&harena, first));
+}
+
+void test_arena_allocator_snapshot_api_save_with_null(void) {
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_save(NULL, NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_save(&harena, NULL, NULL));
+}
+
+void test_arena_allocator_snapshot_api_save_root_outside_arena(void) {
+    int value = 0;
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_save(&harena, &value, SNAPSHOT_PATH));
+}
+
+void test_arena_allocator_snapshot_api_load_with_null(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_load(NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_load(&hsnapshot, NULL));
+}
+
+void test_arena_allocator_snapshot_api_load_missing_file(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    (void)remove(SNAPSHOT_PATH);
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    TEST_ASSERT_NULL(hsnapshot.base);
+}
+
+void test_arena_allocator_snapshot_api_load_invalid_file(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    FILE *file = fopen(SNAPSHOT_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    const char garbage[64U] = "not a snapshot";
+    TEST_ASSERT_EQUAL_size_t(1U, fwrite(garbage, sizeof(garbage), 1U, file));
+    fclose(file);
+    TEST_ASSERT_FALSE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_load_root(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    int *item = arena_allocator_api_alloc(&harena, sizeof(int));
+    *item = 42;
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, item, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    const int *root = arena_allocator_snapshot_api_root(&hsnapshot);
+    TEST_ASSERT_NOT_NULL(root);
+    TEST_ASSERT_NOT_EQUAL(item, root);
+    TEST_ASSERT_EQUAL_INT(42, *root);
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    TEST_ASSERT_NULL(hsnapshot.base);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_save_used_part(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    (void)arena_allocator_api_alloc(&harena, ARENA_ALLOCATOR_BLOCK_SIZE);
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    /*! The unused memory at the end of the first block is not written */
+    TEST_ASSERT_TRUE(hsnapshot.size < harena.items[0U].size + harena.offset);
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+#if defined(ARENA_ALLOCATOR_DEBUG) && defined(__SANITIZE_ADDRESS__)
+void test_arena_allocator_snapshot_api_save_keeps_poison(void) {
+    uint8_t *item = arena_allocator_api_alloc(&harena, 8U);
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, item, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(__asan_address_is_poisoned(item + 8U));
+    (void)remove(SNAPSHOT_PATH);
+}
+#endif // ARENA_ALLOCATOR_DEBUG
+
+void test_arena_allocator_snapshot_api_load_without_root(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_root(&hsnapshot));
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_load_list_across_blocks(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    struct ArenaAllocatorConfig config = { .block_size = 256U, .tracking = ARENA_ALLOCATOR_TRACKING_CHUNKED };
+    arena_allocator_api_free(&harena);
+    arena_allocator_api_init_with_config(&harena, &config);
+    struct SnapshotNode *head = NULL;
+    for (int i = 0; i < 100; ++i) {
+        struct SnapshotNode *node = ARENA_NEW(&harena, struct SnapshotNode);
+        node->next = arena_allocator_snapshot_api_offset(&harena, head);
+        node->value = i;
+        head = node;
+    }
+    TEST_ASSERT_GREATER_THAN_size_t(1U, harena.size);
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, head, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    int expected = 99;
+    for (const struct SnapshotNode *node = arena_allocator_snapshot_api_root(&hsnapshot); node != NULL;
+         node = arena_allocator_snapshot_api_resolve(&hsnapshot, node->next)) {
+        TEST_ASSERT_EQUAL_INT(expected, node->value);
+        --expected;
+    }
+    TEST_ASSERT_EQUAL_INT(-1, expected);
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_load_keeps_alignment(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    (void)arena_allocator_api_alloc(&harena, 1U);
+    void *item = arena_allocator_api_alloc_aligned(&harena, 8U, ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT);
+    const size_t offset = arena_allocator_snapshot_api_offset(&harena, item);
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    const void *loaded = arena_allocator_snapshot_api_resolve(&hsnapshot, offset);
+    TEST_ASSERT_NOT_NULL(loaded);
+    TEST_ASSERT_EQUAL_size_t(0U, (uintptr_t)loaded % ARENA_ALLOCATOR_SNAPSHOT_ALIGNMENT);
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_resolve_invalid_offset(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    (void)arena_allocator_api_alloc(&harena, sizeof(int));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve(&hsnapshot, 0U));
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve(&hsnapshot, hsnapshot.size));
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve(NULL, sizeof(struct ArenaAllocatorSnapshotHeader)));
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_resolve_handle(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    arena_allocator_api_free(&harena);
+    arena_allocator_api_init_static(&harena, offset_buffer, sizeof(offset_buffer));
+    (void)arena_allocator_api_alloc(&harena, 3U);
+    uint32_t head = 0U;
+    for (int i = 0; i < 10; ++i) {
+        const uint32_t offset = arena_allocator_api_alloc_offset(&harena, sizeof(struct HandleNode));
+        TEST_ASSERT_NOT_EQUAL(0U, offset);
+        struct HandleNode *node = ARENA_RESOLVE(&harena, struct HandleNode, offset);
+        node->next = head;
+        node->value = i;
+        head = offset;
+    }
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, ARENA_RESOLVE(&harena, struct HandleNode, head), SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    TEST_ASSERT_EQUAL_PTR(arena_allocator_snapshot_api_root(&hsnapshot), arena_allocator_snapshot_api_resolve_handle(&hsnapshot, head));
+    int expected = 9;
+    for (const struct HandleNode *node = arena_allocator_snapshot_api_resolve_handle(&hsnapshot, head); node != NULL;
+         node = arena_allocator_snapshot_api_resolve_handle(&hsnapshot, node->next)) {
+        TEST_ASSERT_EQUAL_INT(expected, node->value);
+        --expected;
+    }
+    TEST_ASSERT_EQUAL_INT(-1, expected);
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve_handle(NULL, head));
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve_handle(&hsnapshot, 0U));
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve_handle(&hsnapshot, UINT32_MAX));
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+void test_arena_allocator_snapshot_api_resolve_handle_empty_arena(void) {
+    struct ArenaAllocatorSnapshotHandler hsnapshot;
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_save(&harena, NULL, SNAPSHOT_PATH));
+    TEST_ASSERT_TRUE(arena_allocator_snapshot_api_load(&hsnapshot, SNAPSHOT_PATH));
+    TEST_ASSERT_EQUAL_size_t(0U, hsnapshot.first);
+    TEST_ASSERT_NULL(arena_allocator_snapshot_api_resolve_handle(&hsnapshot, ARENA_ALLOCATOR_ALIGNMENT));
+    arena_allocator_snapshot_api_unload(&hsnapshot);
+    (void)remove(SNAPSHOT_PATH);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup pool Test pool of recyclable items
+ * @{
+ */
+
+void test_arena_allocator_pool_api_alloc_with_null(void) {
+    void *item = arena_allocator_pool_api_alloc(NULL, sizeof(int));
+    TEST_ASSERT_NULL(item);
 }
 
-void test_arena_allocator_api_free_capacity(void) {
-    (void)arena_allocator_api_alloc(&harena, sizeof(int));
-    arena_allocator_api_free(&harena);
-    TEST_ASSERT_EQUAL_size_t(0U, harena.capacity);
+void test_arena_allocator_pool_api_alloc_with_zero_size(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *item = arena_allocator_pool_api_alloc(&hpool, 0U);
+    TEST_ASSERT_NULL(item);
 }
-void test_arena_allocator_api_free_address(void) {
-    (void)arena_allocator_api_alloc(&harena, sizeof(int));
-    arena_allocator_api_free(&harena);
-    TEST_ASSERT_EQUAL_PTR(NULL, harena.items);
+
+void test_arena_allocator_pool_api_alloc_too_big(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *item = arena_allocator_pool_api_alloc(&hpool, ((size_t)ARENA_ALLOCATOR_ALIGNMENT << (ARENA_ALLOCATOR_POOL_CLASSES - 1U)) + 1U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_pool_api_alloc_class_size(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    uint8_t *first = arena_allocator_pool_api_alloc(&hpool, ARENA_ALLOCATOR_ALIGNMENT + 1U);
+    uint8_t *second = arena_allocator_pool_api_alloc(&hpool, ARENA_ALLOCATOR_ALIGNMENT + 1U);
+    TEST_ASSERT_EQUAL_PTR(first + 2U * ARENA_ALLOCATOR_ALIGNMENT, second);
+}
+
+void test_arena_allocator_pool_api_free_reuse(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *item = arena_allocator_pool_api_alloc(&hpool, 24U);
+    arena_allocator_pool_api_free(&hpool, item, 24U);
+    void *reused = arena_allocator_pool_api_alloc(&hpool, 20U);
+    TEST_ASSERT_EQUAL_PTR(item, reused);
+}
+
+void test_arena_allocator_pool_api_free_other_class(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *item = arena_allocator_pool_api_alloc(&hpool, 8U);
+    arena_allocator_pool_api_free(&hpool, item, 8U);
+    void *other = arena_allocator_pool_api_alloc(&hpool, 64U);
+    TEST_ASSERT_NOT_EQUAL(item, other);
+}
+
+void test_arena_allocator_pool_api_free_lifo(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *first = arena_allocator_pool_api_alloc(&hpool, 32U);
+    void *second = arena_allocator_pool_api_alloc(&hpool, 32U);
+    arena_allocator_pool_api_free(&hpool, first, 32U);
+    arena_allocator_pool_api_free(&hpool, second, 32U);
+    TEST_ASSERT_EQUAL_PTR(second, arena_allocator_pool_api_alloc(&hpool, 32U));
+    TEST_ASSERT_EQUAL_PTR(first, arena_allocator_pool_api_alloc(&hpool, 32U));
+}
+
+void test_arena_allocator_pool_api_churn_no_growth(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    for (size_t i = 0U; i < 4U * ARENA_ALLOCATOR_BLOCK_SIZE; ++i) {
+        void *item = arena_allocator_pool_api_alloc(&hpool, 48U);
+        TEST_ASSERT_NOT_NULL(item);
+        arena_allocator_pool_api_free(&hpool, item, 48U);
+    }
+    TEST_ASSERT_EQUAL(1U, harena.size);
+}
+
+void test_arena_allocator_pool_api_reset(void) {
+    struct ArenaAllocatorPoolHandler hpool;
+    arena_allocator_pool_api_init(&hpool, &harena);
+    void *item = arena_allocator_pool_api_alloc(&hpool, 16U);
+    arena_allocator_pool_api_free(&hpool, item, 16U);
+    arena_allocator_pool_api_reset(&hpool);
+    TEST_ASSERT_NULL(hpool.free[0U]);
+}
+
+/*! @} */
+
+/*!
+ * \defgroup concurrent Test thread safe arena
+ * @{
+ */
+
+void test_arena_allocator_concurrent_api_alloc_with_null(void) {
+    void *item = arena_allocator_concurrent_api_alloc(NULL, sizeof(int));
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_concurrent_api_alloc_with_zero_size(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    void *item = arena_allocator_concurrent_api_alloc(&hcache, 0U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_concurrent_api_alloc_same_chunk_address(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    char *first = (char *)arena_allocator_concurrent_api_alloc(&hcache, sizeof(int));
+    char *second = (char *)arena_allocator_concurrent_api_alloc(&hcache, sizeof(int));
+    TEST_ASSERT_EQUAL_PTR(first + ARENA_ALLOCATOR_ALIGNMENT, second);
+    arena_allocator_concurrent_api_free(&hconcurrent);
+}
+
+void test_arena_allocator_concurrent_api_alloc_aligned_address(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    const size_t align = 64U;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    (void)arena_allocator_concurrent_api_alloc(&hcache, 1U);
+    void *item = arena_allocator_concurrent_api_alloc_aligned(&hcache, sizeof(int), align);
+    TEST_ASSERT_EQUAL_size_t(0U, (size_t)item % align);
+    arena_allocator_concurrent_api_free(&hconcurrent);
+}
+
+void test_arena_allocator_concurrent_api_alloc_big_item_keeps_chunk(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    char *first = (char *)arena_allocator_concurrent_api_alloc(&hcache, sizeof(int));
+    (void)arena_allocator_concurrent_api_alloc(&hcache, ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE * 2U);
+    char *second = (char *)arena_allocator_concurrent_api_alloc(&hcache, sizeof(int));
+    TEST_ASSERT_EQUAL_PTR(first + ARENA_ALLOCATOR_ALIGNMENT, second);
+    arena_allocator_concurrent_api_free(&hconcurrent);
+}
+
+void test_arena_allocator_concurrent_api_alloc_when_full_block(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    const size_t chunks = ARENA_ALLOCATOR_CONCURRENT_BLOCK_SIZE / ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE;
+    for (size_t i = 0U; i <= chunks; ++i)
+        TEST_ASSERT_NOT_NULL(arena_allocator_concurrent_api_alloc(&hcache, ARENA_ALLOCATOR_CONCURRENT_CHUNK_SIZE));
+    struct ArenaAllocatorConcurrentBlock *head = atomic_load(&hconcurrent.head);
+    TEST_ASSERT_NOT_NULL(head->next);
+    arena_allocator_concurrent_api_free(&hconcurrent);
+}
+
+void test_arena_allocator_concurrent_api_calloc_with_overflow(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    void *item = arena_allocator_concurrent_api_calloc(&hcache, SIZE_MAX / 2U + 1U, 2U);
+    TEST_ASSERT_NULL(item);
+}
+
+void test_arena_allocator_concurrent_api_calloc_zeroed(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    const size_t count = 16U;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    int *item = (int *)arena_allocator_concurrent_api_calloc(&hcache, sizeof(*item), count);
+    TEST_ASSERT_EACH_EQUAL_INT(0, item, count);
+    arena_allocator_concurrent_api_free(&hconcurrent);
+}
+
+void test_arena_allocator_concurrent_api_free_head(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    struct ArenaAllocatorConcurrentCache hcache;
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    arena_allocator_concurrent_api_cache_init(&hcache, &hconcurrent);
+    (void)arena_allocator_concurrent_api_alloc(&hcache, sizeof(int));
+    arena_allocator_concurrent_api_free(&hconcurrent);
+    TEST_ASSERT_NULL(atomic_load(&hconcurrent.head));
+}
+
+#if defined(__unix__)
+
+#define TEST_CONCURRENT_THREADS (4U)
+#define TEST_CONCURRENT_ITEMS (4096U)
+
+/*!
+ * \brief Allocate many items from a thread and check that no other thread
+ *      wrote inside them.
+ */
+static void *test_concurrent_worker(void *arg) {
+    struct ArenaAllocatorConcurrentHandler *hconcurrent = (struct ArenaAllocatorConcurrentHandler *)arg;
+    struct ArenaAllocatorConcurrentCache hcache;
+    static size_t *items[TEST_CONCURRENT_THREADS][TEST_CONCURRENT_ITEMS];
+    static atomic_size_t next_id;
+    const size_t id = atomic_fetch_add(&next_id, 1U) % TEST_CONCURRENT_THREADS;
+
+    arena_allocator_concurrent_api_cache_init(&hcache, hconcurrent);
+    for (size_t i = 0U; i < TEST_CONCURRENT_ITEMS; ++i) {
+        items[id][i] = (size_t *)arena_allocator_concurrent_api_alloc(&hcache, sizeof(size_t) * (1U + i % 7U));
+        if (items[id][i] == NULL) {
+            return (void *)1;
+        }
+        *items[id][i] = id * TEST_CONCURRENT_ITEMS + i;
+    }
+    for (size_t i = 0U; i < TEST_CONCURRENT_ITEMS; ++i) {
+        if (*items[id][i] != id * TEST_CONCURRENT_ITEMS + i) {
+            return (void *)1;
+        }
+    }
+    return NULL;
+}
+
+void test_arena_allocator_concurrent_api_alloc_from_threads(void) {
+    struct ArenaAllocatorConcurrentHandler hconcurrent;
+    pthread_t threads[TEST_CONCURRENT_THREADS];
+    arena_allocator_concurrent_api_init(&hconcurrent);
+    for (size_t i = 0U; i < TEST_CONCURRENT_THREADS; ++i)
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, test_concurrent_worker, &hconcurrent));
+    size_t failures = 0U;
+    for (size_t i = 0U; i < TEST_CONCURRENT_THREADS; ++i) {
+        void *result = NULL;
+        (void)pthread_join(threads[i], &result);
+        failures += result != NULL;
+    }
+    arena_allocator_concurrent_api_free(&hconcurrent);
+    TEST_ASSERT_EQUAL_size_t(0U, failures);
+}
+
+#endif // __unix__
+
+/*! @} */
+
+/*!
+ * \defgroup ring Test ring arena for a single producer and a single consumer
+ * @{
+ */
+
+/*! Buffer used by the ring arenas */
+static _Alignas(ARENA_ALLOCATOR_ALIGNMENT) uint8_t ring_buffer[1024U];
+
+void test_arena_allocator_ring_api_init_with_null(void) {
+    struct ArenaAllocatorRingHandler hring;
+    TEST_ASSERT_FALSE(arena_allocator_ring_api_init(NULL, ring_buffer, sizeof(ring_buffer)));
+    TEST_ASSERT_FALSE(arena_allocator_ring_api_init(&hring, NULL, sizeof(ring_buffer)));
+    TEST_ASSERT_NULL(arena_allocator_ring_api_alloc(&hring, sizeof(int)));
+}
+
+void test_arena_allocator_ring_api_init_with_too_small_buffer(void) {
+    struct ArenaAllocatorRingHandler hring;
+    TEST_ASSERT_FALSE(arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(struct ArenaAllocatorRingRecord)));
+}
+
+void test_arena_allocator_ring_api_init_capacity(void) {
+    struct ArenaAllocatorRingHandler hring;
+    TEST_ASSERT_TRUE(arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer) - 1U));
+    TEST_ASSERT_EQUAL_size_t(sizeof(ring_buffer) / 2U, hring.capacity);
+    TEST_ASSERT_EQUAL_size_t(0U, (uintptr_t)hring.buffer % ARENA_ALLOCATOR_ALIGNMENT);
+}
+
+void test_arena_allocator_ring_api_alloc_with_zero_size(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    TEST_ASSERT_NULL(arena_allocator_ring_api_alloc(&hring, 0U));
+    TEST_ASSERT_NULL(arena_allocator_ring_api_alloc(NULL, sizeof(int)));
+}
+
+void test_arena_allocator_ring_api_alloc_too_big(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    TEST_ASSERT_NULL(arena_allocator_ring_api_alloc(&hring, sizeof(ring_buffer)));
+}
+
+void test_arena_allocator_ring_api_alloc_aligned(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    for (size_t i = 1U; i < 8U; ++i) {
+        void *item = arena_allocator_ring_api_alloc(&hring, i);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_size_t(0U, (uintptr_t)item % ARENA_ALLOCATOR_ALIGNMENT);
+    }
+}
+
+void test_arena_allocator_ring_api_peek_before_commit(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    (void)arena_allocator_ring_api_alloc(&hring, sizeof(int));
+    TEST_ASSERT_NULL(arena_allocator_ring_api_peek(&hring, NULL));
+    TEST_ASSERT_FALSE(arena_allocator_ring_api_release(&hring));
+}
+
+void test_arena_allocator_ring_api_peek_fifo(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    for (int i = 0; i < 4; ++i) {
+        int *item = arena_allocator_ring_api_alloc(&hring, sizeof(int));
+        *item = i;
+    }
+    arena_allocator_ring_api_commit(&hring);
+    for (int i = 0; i < 4; ++i) {
+        size_t size = 0U;
+        const int *item = arena_allocator_ring_api_peek(&hring, &size);
+        TEST_ASSERT_NOT_NULL(item);
+        TEST_ASSERT_EQUAL_size_t(sizeof(int), size);
+        TEST_ASSERT_EQUAL_INT(i, *item);
+        TEST_ASSERT_TRUE(arena_allocator_ring_api_release(&hring));
+    }
+    TEST_ASSERT_NULL(arena_allocator_ring_api_peek(&hring, NULL));
+}
+
+void test_arena_allocator_ring_api_alloc_when_full(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    size_t count = 0U;
+    while (arena_allocator_ring_api_alloc(&hring, 40U) != NULL) {
+        ++count;
+    }
+    TEST_ASSERT_GREATER_THAN_size_t(0U, count);
+    arena_allocator_ring_api_commit(&hring);
+    TEST_ASSERT_TRUE(arena_allocator_ring_api_release(&hring));
+    TEST_ASSERT_NOT_NULL(arena_allocator_ring_api_alloc(&hring, 40U));
 }
 
+void test_arena_allocator_ring_api_wrap_around(void) {
+    struct ArenaAllocatorRingHandler hring;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    uint8_t expected = 0U;
+    uint8_t value = 0U;
+    for (size_t i = 0U; i < 1000U; ++i) {
+        const size_t size = 1U + (i * 37U) % 200U;
+        uint8_t *item = arena_allocator_ring_api_alloc(&hring, size);
+        while (item == NULL) {
+            size_t length = 0U;
+            const uint8_t *record = arena_allocator_ring_api_peek(&hring, &length);
+            TEST_ASSERT_NOT_NULL(record);
+            TEST_ASSERT_EACH_EQUAL_UINT8(expected, record, length);
+            ++expected;
+            TEST_ASSERT_TRUE(arena_allocator_ring_api_release(&hring));
+            item = arena_allocator_ring_api_alloc(&hring, size);
+        }
+        TEST_ASSERT_TRUE(item >= hring.buffer && item + size <= hring.buffer + hring.capacity);
+        memset(item, value++, size);
+        arena_allocator_ring_api_commit(&hring);
+    }
+    TEST_ASSERT_GREATER_THAN_size_t(hring.capacity, atomic_load(&hring.head));
+}
+
+#if defined(__unix__)
+
+#define TEST_RING_MESSAGES (20000U)
+
+/*!
+ * \brief Produce messages of variable size filled with their sequence number.
+ */
+static void *test_ring_producer(void *arg) {
+    struct ArenaAllocatorRingHandler *hring = (struct ArenaAllocatorRingHandler *)arg;
+    for (size_t i = 0U; i < TEST_RING_MESSAGES; ++i) {
+        const size_t count = 1U + i % 13U;
+        size_t *item = NULL;
+        while ((item = arena_allocator_ring_api_alloc(hring, count * sizeof(size_t))) == NULL) {
+            (void)sched_yield();
+        }
+        for (size_t j = 0U; j < count; ++j) {
+            item[j] = i;
+        }
+        arena_allocator_ring_api_commit(hring);
+    }
+    return NULL;
+}
+
+void test_arena_allocator_ring_api_producer_consumer(void) {
+    static struct ArenaAllocatorRingHandler hring;
+    pthread_t producer;
+    (void)arena_allocator_ring_api_init(&hring, ring_buffer, sizeof(ring_buffer));
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL, test_ring_producer, &hring));
+    size_t failures = 0U;
+    for (size_t i = 0U; i < TEST_RING_MESSAGES; ++i) {
+        size_t size = 0U;
+        const size_t *item = NULL;
+        while ((item = arena_allocator_ring_api_peek(&hring, &size)) == NULL) {
+            (void)sched_yield();
+        }
+        failures += size != (1U + i % 13U) * sizeof(size_t);
+        for (size_t j = 0U; j < size / sizeof(size_t); ++j) {
+            failures += item[j] != i;
+        }
+        (void)arena_allocator_ring_api_release(&hring);
+    }
+    (void)pthread_join(producer, NULL);
+    TEST_ASSERT_EQUAL_size_t(0U, failures);
+    TEST_ASSERT_NULL(arena_allocator_ring_api_peek(&hring, NULL));
+}
+
+#endif // __unix__
+
 /*! @} */
 
 int main(void) {
@@ -321,6 +2602,25 @@ int main(void) {
 
     /*! @} */
 
+    /*!
+     * \ingroup bump Run test for item allocation inside the arena blocks
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_bump_when_empty_arena_size);
+    RUN_TEST(test_arena_allocator_api_bump_when_empty_block_size);
+    RUN_TEST(test_arena_allocator_api_bump_same_block_arena_size);
+    RUN_TEST(test_arena_allocator_api_bump_alignment);
+    RUN_TEST(test_arena_allocator_api_bump_when_full_block_arena_size);
+    RUN_TEST(test_arena_allocator_api_bump_when_bigger_than_block_size_with_alignment);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_bump_same_block_address);
+    RUN_TEST(test_arena_allocator_api_bump_when_full_block_address);
+    RUN_TEST(test_arena_allocator_api_bump_when_bigger_than_block_size);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
     /*!
      * \ingroup init Run test for initialization
      * @{
@@ -331,6 +2631,98 @@ int main(void) {
 
     /*! @} */
 
+    /*!
+     * \ingroup init_with_config Run test for initialization with a custom configuration
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_init_with_config_with_null_config);
+    RUN_TEST(test_arena_allocator_api_init_with_config_initial_capacity);
+    RUN_TEST(test_arena_allocator_api_init_with_config_growth_factor);
+    RUN_TEST(test_arena_allocator_api_init_with_config_growth_increment);
+    RUN_TEST(test_arena_allocator_api_init_with_config_max_capacity);
+    RUN_TEST(test_arena_allocator_api_init_with_config_max_capacity_when_full);
+    RUN_TEST(test_arena_allocator_api_reserve_with_null);
+    RUN_TEST(test_arena_allocator_api_reserve_capacity);
+    RUN_TEST(test_arena_allocator_api_reserve_smaller_capacity);
+    RUN_TEST(test_arena_allocator_api_reserve_without_realloc_address);
+    RUN_TEST(test_arena_allocator_api_reserve_over_max_capacity);
+    RUN_TEST(test_arena_allocator_api_reserve_static);
+    RUN_TEST(test_arena_allocator_api_chunked_capacity);
+    RUN_TEST(test_arena_allocator_api_chunked_blocks_not_moved);
+    RUN_TEST(test_arena_allocator_api_chunked_alloc_values);
+    RUN_TEST(test_arena_allocator_api_chunked_rewind_address);
+    RUN_TEST(test_arena_allocator_api_chunked_reset_reuses_blocks);
+    RUN_TEST(test_arena_allocator_api_chunked_reset_alloc_bigger_than_kept_block);
+    RUN_TEST(test_arena_allocator_api_chunked_reserve);
+    RUN_TEST(test_arena_allocator_api_chunked_reserve_rewind_bigger_block);
+    RUN_TEST(test_arena_allocator_api_chunked_spare_follows_reserved);
+    RUN_TEST(test_arena_allocator_api_chunked_rewind_current);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_init_with_config_block_size);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup init_static Run test for initialization over a caller supplied buffer
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_init_static_with_null);
+    RUN_TEST(test_arena_allocator_api_init_static_with_null_buffer);
+    RUN_TEST(test_arena_allocator_api_init_static_with_too_small_buffer);
+    RUN_TEST(test_arena_allocator_api_init_static_block_inside_buffer);
+    RUN_TEST(test_arena_allocator_api_init_static_alloc_when_exhausted_arena_size);
+    RUN_TEST(test_arena_allocator_api_init_static_free_keeps_buffer);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_init_static_alloc_address);
+    RUN_TEST(test_arena_allocator_api_init_static_alloc_when_exhausted);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup init_vm Run test for initialization over a range of virtual memory
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_init_vm_with_null);
+    RUN_TEST(test_arena_allocator_api_init_vm_with_zero_size);
+#if defined(__linux__)
+    RUN_TEST(test_arena_allocator_api_init_vm_backend);
+    RUN_TEST(test_arena_allocator_api_init_vm_lazy_commit);
+    RUN_TEST(test_arena_allocator_api_init_vm_exhausted);
+    RUN_TEST(test_arena_allocator_api_init_vm_reset_zeroed);
+    RUN_TEST(test_arena_allocator_api_init_vm_with_config_transparent_huge);
+    RUN_TEST(test_arena_allocator_api_init_vm_with_config_invalid_numa_node);
+    RUN_TEST(test_arena_allocator_api_init_vm_free);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_init_vm_contiguous);
+    RUN_TEST(test_arena_allocator_api_init_vm_realloc_in_place);
+#endif // ARENA_ALLOCATOR_DEBUG
+#endif // __linux__
+
+    /*! @} */
+
+    /*!
+     * \ingroup init_child Run test for initialization of an arena nested in another one
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_init_child_with_null_parent);
+    RUN_TEST(test_arena_allocator_api_init_child_backend);
+    RUN_TEST(test_arena_allocator_api_init_child_alloc_from_parent);
+    RUN_TEST(test_arena_allocator_api_init_child_reset_keeps_blocks);
+    RUN_TEST(test_arena_allocator_api_init_child_nested);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_init_child_free_gives_back);
+    RUN_TEST(test_arena_allocator_api_init_child_free_interleaved);
+    RUN_TEST(test_arena_allocator_api_init_child_big_item);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
     /*!
      * \ingroup alloc Run test for allocation of a single item
      * @{
@@ -339,8 +2731,44 @@ int main(void) {
     RUN_TEST(test_arena_allocator_api_alloc_with_null);
     RUN_TEST(test_arena_allocator_api_alloc_with_zero_size);
     RUN_TEST(test_arena_allocator_api_alloc_with_null_and_zero_size);
+#ifndef ARENA_ALLOCATOR_DEBUG
     RUN_TEST(test_arena_allocator_api_alloc_address);
     RUN_TEST(test_arena_allocator_api_alloc_value);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup alloc_aligned Run test for allocation of a single aligned item
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_with_null);
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_with_zero_size);
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_with_zero_alignment);
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_with_non_power_of_two_alignment);
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_address);
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_same_block);
+    RUN_TEST(test_arena_allocator_api_calloc_aligned_address);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_alloc_aligned_small_alignment_packs_items);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup typed Run test for typed allocation
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_new_with_null);
+    RUN_TEST(test_arena_allocator_api_new_when_full_block);
+    RUN_TEST(test_arena_allocator_api_new_array_with_overflow);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_new_type_alignment);
+    RUN_TEST(test_arena_allocator_api_new_packed);
+    RUN_TEST(test_arena_allocator_api_new_array_size);
+#endif // ARENA_ALLOCATOR_DEBUG
 
     /*! @} */
 
@@ -356,8 +2784,126 @@ int main(void) {
     RUN_TEST(test_arena_allocator_api_calloc_with_null_and_zero_count);
     RUN_TEST(test_arena_allocator_api_calloc_with_zero_size_and_zero_count);
     RUN_TEST(test_arena_allocator_api_calloc_with_null_and_zero_size_and_zero_count);
+    RUN_TEST(test_arena_allocator_api_calloc_with_overflow);
+    RUN_TEST(test_arena_allocator_api_calloc_zeroed);
+    RUN_TEST(test_arena_allocator_api_calloc_zeroed_when_reused);
+    RUN_TEST(test_arena_allocator_api_calloc_zeroed_when_reset);
+    RUN_TEST(test_arena_allocator_api_calloc_zeroed_when_static);
+    RUN_TEST(test_arena_allocator_api_calloc_fresh_block_clean);
+#ifndef ARENA_ALLOCATOR_DEBUG
     RUN_TEST(test_arena_allocator_api_calloc_address);
     RUN_TEST(test_arena_allocator_api_calloc_values);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup alloc_batch Run test for allocation of a batch of items
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_alloc_batch_with_null);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_with_zero_count);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_with_zero_size);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_with_overflow);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_address);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_single_block);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_bigger_than_block_size);
+    RUN_TEST(test_arena_allocator_api_alloc_batch_when_exhausted);
+    RUN_TEST(test_arena_allocator_api_alloc_n_with_null);
+    RUN_TEST(test_arena_allocator_api_alloc_n_with_zero_size);
+    RUN_TEST(test_arena_allocator_api_alloc_n_with_overflow);
+    RUN_TEST(test_arena_allocator_api_alloc_n_address);
+
+    /*! @} */
+
+    /*!
+     * \ingroup offset Run test for allocation of items referenced by offset
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_alloc_offset_with_null);
+    RUN_TEST(test_arena_allocator_api_alloc_offset_with_zero_size);
+    RUN_TEST(test_arena_allocator_api_alloc_offset_when_heap);
+    RUN_TEST(test_arena_allocator_api_alloc_offset_resolve);
+    RUN_TEST(test_arena_allocator_api_alloc_offset_aligned);
+    RUN_TEST(test_arena_allocator_api_alloc_offset_when_exhausted);
+    RUN_TEST(test_arena_allocator_api_offset_outside_arena);
+#if !defined(ARENA_ALLOCATOR_DEBUG) || !defined(__SANITIZE_ADDRESS__)
+    RUN_TEST(test_arena_allocator_api_alloc_offset_relocatable);
+#endif // ARENA_ALLOCATOR_DEBUG
+#if defined(__linux__)
+    RUN_TEST(test_arena_allocator_api_alloc_offset_when_vm);
+#endif // __linux__
+
+    /*! @} */
+
+    /*!
+     * \ingroup realloc Run test for resize of an item
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_realloc_with_null);
+    RUN_TEST(test_arena_allocator_api_realloc_with_null_item);
+    RUN_TEST(test_arena_allocator_api_realloc_with_zero_size);
+    RUN_TEST(test_arena_allocator_api_realloc_not_last_copy);
+    RUN_TEST(test_arena_allocator_api_realloc_not_last_shrink);
+    RUN_TEST(test_arena_allocator_api_realloc_when_full_block);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_realloc_grow_in_place);
+    RUN_TEST(test_arena_allocator_api_realloc_shrink_in_place);
+    RUN_TEST(test_arena_allocator_api_realloc_growing_buffer);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup dtor Run test for cleanup callbacks
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_alloc_with_dtor_with_null);
+    RUN_TEST(test_arena_allocator_api_alloc_with_dtor_without_dtor);
+    RUN_TEST(test_arena_allocator_api_alloc_with_dtor_free_reverse_order);
+    RUN_TEST(test_arena_allocator_api_alloc_with_dtor_rewind);
+    RUN_TEST(test_arena_allocator_api_alloc_with_dtor_reset);
+    RUN_TEST(test_arena_allocator_api_alloc_with_dtor_exhausted_static);
+    RUN_TEST(test_arena_allocator_api_on_free_with_null_dtor);
+    RUN_TEST(test_arena_allocator_api_on_free_external_item);
+
+    /*! @} */
+
+    /*!
+     * \ingroup mark Run test for save points
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_mark_with_null);
+    RUN_TEST(test_arena_allocator_api_mark_values);
+    RUN_TEST(test_arena_allocator_api_rewind_with_null);
+    RUN_TEST(test_arena_allocator_api_rewind_same_block_address);
+    RUN_TEST(test_arena_allocator_api_rewind_keeps_previous_items);
+    RUN_TEST(test_arena_allocator_api_rewind_releases_later_blocks);
+    RUN_TEST(test_arena_allocator_api_rewind_keeps_later_blocks);
+    RUN_TEST(test_arena_allocator_api_rewind_to_empty_arena);
+    RUN_TEST(test_arena_allocator_api_rewind_with_invalid_mark);
+    RUN_TEST(test_arena_allocator_api_rewind_static);
+
+    /*! @} */
+
+    /*!
+     * \ingroup reset Run test for release without deallocation
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_reset_with_null);
+    RUN_TEST(test_arena_allocator_api_reset_size);
+    RUN_TEST(test_arena_allocator_api_reset_keeps_blocks);
+    RUN_TEST(test_arena_allocator_api_reset_alloc_address);
+    RUN_TEST(test_arena_allocator_api_reset_alloc_reuses_blocks);
+    RUN_TEST(test_arena_allocator_api_reset_alloc_bigger_than_kept_block);
+    RUN_TEST(test_arena_allocator_api_reset_loop_stops_allocating);
+    RUN_TEST(test_arena_allocator_api_reset_loop_varying_sizes);
 
     /*! @} */
 
@@ -368,10 +2914,194 @@ int main(void) {
 
     RUN_TEST(test_arena_allocator_api_free_with_null);
     RUN_TEST(test_arena_allocator_api_free_with_null_arena);
-    RUN_TEST(test_arena_allocator_api_free_with_null_item);
     RUN_TEST(test_arena_allocator_api_free_size);
     RUN_TEST(test_arena_allocator_api_free_capacity);
+    RUN_TEST(test_arena_allocator_api_free_after_reset);
     RUN_TEST(test_arena_allocator_api_free_address);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_free_with_null_item);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup debug Run test for debug mode checks
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_check_with_null);
+    RUN_TEST(test_arena_allocator_api_check_when_empty);
+    RUN_TEST(test_arena_allocator_api_check_after_alloc);
+    RUN_TEST(test_arena_allocator_api_debug_handler_flag);
+#if defined(ARENA_ALLOCATOR_DEBUG) && !defined(__SANITIZE_ADDRESS__)
+    RUN_TEST(test_arena_allocator_api_debug_guard_after_item);
+    RUN_TEST(test_arena_allocator_api_debug_guard_before_item);
+    RUN_TEST(test_arena_allocator_api_debug_check_overrun);
+    RUN_TEST(test_arena_allocator_api_debug_check_underrun);
+    RUN_TEST(test_arena_allocator_api_debug_rewind_poison);
+    RUN_TEST(test_arena_allocator_api_debug_reset_poison);
+    RUN_TEST(test_arena_allocator_api_debug_realloc_keeps_guard);
+#endif // ARENA_ALLOCATOR_DEBUG
+#if defined(ARENA_ALLOCATOR_DEBUG) && defined(__SANITIZE_ADDRESS__)
+    RUN_TEST(test_arena_allocator_api_debug_free_static_unpoison);
+#if defined(__linux__)
+    RUN_TEST(test_arena_allocator_api_debug_free_vm_unpoison);
+#endif // __linux__
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup stats Run test for usage statistics
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_get_stats_with_null);
+#ifdef ARENA_ALLOCATOR_STATS
+    RUN_TEST(test_arena_allocator_api_get_stats_with_null_arena);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_api_get_stats_after_alloc);
+    RUN_TEST(test_arena_allocator_api_get_stats_peak_after_reset);
+    RUN_TEST(test_arena_allocator_api_get_stats_after_rewind);
+    RUN_TEST(test_arena_allocator_api_get_stats_after_free);
+    RUN_TEST(test_arena_allocator_api_get_stats_static);
+#endif // ARENA_ALLOCATOR_DEBUG
+#else
+    RUN_TEST(test_arena_allocator_api_get_stats_disabled);
+#endif // ARENA_ALLOCATOR_STATS
+
+    /*! @} */
+
+    /*!
+     * \ingroup trace Run test for allocations traced by call site
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_trace_alloc_with_null);
+    RUN_TEST(test_arena_allocator_api_trace_alloc_with_overflow);
+    RUN_TEST(test_arena_allocator_api_trace_alloc_zeroed);
+    RUN_TEST(test_arena_allocator_api_trace_dump_with_null);
+#ifdef ARENA_ALLOCATOR_TRACE
+    RUN_TEST(test_arena_allocator_api_trace_dump_with_null_arena);
+    RUN_TEST(test_arena_allocator_api_trace_same_site);
+    RUN_TEST(test_arena_allocator_api_trace_different_sites);
+    RUN_TEST(test_arena_allocator_api_trace_alloc_with_dtor);
+    RUN_TEST(test_arena_allocator_api_trace_realloc);
+    RUN_TEST(test_arena_allocator_api_trace_alloc_batch);
+    RUN_TEST(test_arena_allocator_api_trace_alloc_offset);
+    RUN_TEST(test_arena_allocator_api_trace_pool_alloc);
+    RUN_TEST(test_arena_allocator_api_trace_failed_alloc);
+    RUN_TEST(test_arena_allocator_api_trace_sites_overflow);
+    RUN_TEST(test_arena_allocator_api_trace_dump_csv);
+#else
+    RUN_TEST(test_arena_allocator_api_trace_dump_disabled);
+#endif // ARENA_ALLOCATOR_TRACE
+
+    /*! @} */
+
+    /*!
+     * \ingroup snapshot Run test for snapshot of the arena content
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_api_get_block_with_null);
+    RUN_TEST(test_arena_allocator_api_get_block_used_size);
+    RUN_TEST(test_arena_allocator_snapshot_api_offset_with_null);
+    RUN_TEST(test_arena_allocator_snapshot_api_offset_outside_arena);
+    RUN_TEST(test_arena_allocator_snapshot_api_offset_stable);
+    RUN_TEST(test_arena_allocator_snapshot_api_save_with_null);
+    RUN_TEST(test_arena_allocator_snapshot_api_save_root_outside_arena);
+    RUN_TEST(test_arena_allocator_snapshot_api_load_with_null);
+    RUN_TEST(test_arena_allocator_snapshot_api_load_missing_file);
+    RUN_TEST(test_arena_allocator_snapshot_api_load_invalid_file);
+    RUN_TEST(test_arena_allocator_snapshot_api_load_root);
+    RUN_TEST(test_arena_allocator_snapshot_api_save_used_part);
+#if defined(ARENA_ALLOCATOR_DEBUG) && defined(__SANITIZE_ADDRESS__)
+    RUN_TEST(test_arena_allocator_snapshot_api_save_keeps_poison);
+#endif // ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_snapshot_api_load_without_root);
+    RUN_TEST(test_arena_allocator_snapshot_api_load_list_across_blocks);
+    RUN_TEST(test_arena_allocator_snapshot_api_load_keeps_alignment);
+    RUN_TEST(test_arena_allocator_snapshot_api_resolve_invalid_offset);
+    RUN_TEST(test_arena_allocator_snapshot_api_resolve_handle);
+    RUN_TEST(test_arena_allocator_snapshot_api_resolve_handle_empty_arena);
+
+    /*! @} */
+
+    /*!
+     * \ingroup pool Run test for pool of recyclable items
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_pool_api_alloc_with_null);
+    RUN_TEST(test_arena_allocator_pool_api_alloc_with_zero_size);
+    RUN_TEST(test_arena_allocator_pool_api_alloc_too_big);
+    RUN_TEST(test_arena_allocator_pool_api_free_reuse);
+    RUN_TEST(test_arena_allocator_pool_api_free_other_class);
+    RUN_TEST(test_arena_allocator_pool_api_free_lifo);
+    RUN_TEST(test_arena_allocator_pool_api_churn_no_growth);
+    RUN_TEST(test_arena_allocator_pool_api_reset);
+#ifndef ARENA_ALLOCATOR_DEBUG
+    RUN_TEST(test_arena_allocator_pool_api_alloc_class_size);
+#endif // ARENA_ALLOCATOR_DEBUG
+
+    /*! @} */
+
+    /*!
+     * \ingroup concurrent Run test for thread safe arena
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_with_null);
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_with_zero_size);
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_same_chunk_address);
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_aligned_address);
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_big_item_keeps_chunk);
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_when_full_block);
+    RUN_TEST(test_arena_allocator_concurrent_api_calloc_with_overflow);
+    RUN_TEST(test_arena_allocator_concurrent_api_calloc_zeroed);
+    RUN_TEST(test_arena_allocator_concurrent_api_free_head);
+#if defined(__unix__)
+    RUN_TEST(test_arena_allocator_concurrent_api_alloc_from_threads);
+#endif // __unix__
+
+    /*! @} */
+
+    /*!
+     * \ingroup ring Run test for ring arena for a single producer and a single consumer
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_ring_api_init_with_null);
+    RUN_TEST(test_arena_allocator_ring_api_init_with_too_small_buffer);
+    RUN_TEST(test_arena_allocator_ring_api_init_capacity);
+    RUN_TEST(test_arena_allocator_ring_api_alloc_with_zero_size);
+    RUN_TEST(test_arena_allocator_ring_api_alloc_too_big);
+    RUN_TEST(test_arena_allocator_ring_api_alloc_aligned);
+    RUN_TEST(test_arena_allocator_ring_api_peek_before_commit);
+    RUN_TEST(test_arena_allocator_ring_api_peek_fifo);
+    RUN_TEST(test_arena_allocator_ring_api_alloc_when_full);
+    RUN_TEST(test_arena_allocator_ring_api_wrap_around);
+#if defined(__unix__)
+    RUN_TEST(test_arena_allocator_ring_api_producer_consumer);
+#endif // __unix__
+
+    /*! @} */
+
+    /*!
+     * \ingroup wrapper Run test for the C++ wrapper
+     * @{
+     */
+
+    RUN_TEST(test_arena_allocator_wrapper_make_registers_dtor);
+    RUN_TEST(test_arena_allocator_wrapper_make_trivial_without_dtor);
+    RUN_TEST(test_arena_allocator_wrapper_make_when_full);
+    RUN_TEST(test_arena_allocator_wrapper_free_runs_dtors);
+    RUN_TEST(test_arena_allocator_wrapper_rewind_runs_dtors);
+    RUN_TEST(test_arena_allocator_wrapper_allocator_equality);
+    RUN_TEST(test_arena_allocator_wrapper_allocator_rebind);
+    RUN_TEST(test_arena_allocator_wrapper_allocate_with_zero_size);
+    RUN_TEST(test_arena_allocator_wrapper_memory_resource_equality);
 
     /*! @} */
 
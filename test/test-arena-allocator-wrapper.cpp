@@ -0,0 +1,158 @@
+/*!
+ * \file test-arena-allocator-wrapper.cpp
+ * \date 2026-10-16
+ * \authors Antonio Gelain [antonio.gelain2@gmail.com]
+ *
+ * \brief Unit test for the C++ wrapper of the arena allocator.
+ * \details The tests are run by the main function of the unit test for the
+ *      arena allocator api, so they are exported with C linkage.
+ */
+
+#include "unity.h"
+#include "arena-allocator.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+/*!
+ * \brief Object with a destructor allocated inside the arena
+ */
+struct Counter {
+    static int destroyed; /*!< The number of objects destroyed so far */
+    int value;            /*!< The value of the object */
+
+    explicit Counter(int value) : value(value) {
+    }
+
+    ~Counter() {
+        ++destroyed;
+    }
+};
+
+int Counter::destroyed = 0;
+
+/*!
+ * \defgroup wrapper Test the C++ wrapper
+ * @{
+ */
+
+extern "C" void test_arena_allocator_wrapper_make_registers_dtor(void) {
+    Counter::destroyed = 0;
+    arena_allocator::Arena arena;
+    const Counter *counter = arena.make<Counter>(7);
+    TEST_ASSERT_NOT_NULL(counter);
+    TEST_ASSERT_EQUAL_INT(7, counter->value);
+    TEST_ASSERT_EQUAL_size_t(0U, reinterpret_cast<std::uintptr_t>(counter) % alignof(Counter));
+    TEST_ASSERT_NOT_NULL(arena.handle()->dtors);
+    TEST_ASSERT_EQUAL_PTR(counter, arena.handle()->dtors->item);
+    arena.reset();
+    TEST_ASSERT_EQUAL_INT(1, Counter::destroyed);
+    TEST_ASSERT_NULL(arena.handle()->dtors);
+}
+
+extern "C" void test_arena_allocator_wrapper_make_trivial_without_dtor(void) {
+    arena_allocator::Arena arena;
+    const int *value = arena.make<int>(42);
+    TEST_ASSERT_NOT_NULL(value);
+    TEST_ASSERT_EQUAL_INT(42, *value);
+    TEST_ASSERT_NULL(arena.handle()->dtors);
+}
+
+extern "C" void test_arena_allocator_wrapper_make_when_full(void) {
+    alignas(ARENA_ALLOCATOR_ALIGNMENT) static unsigned char buffer[256U];
+    Counter::destroyed = 0;
+    arena_allocator::Arena arena(buffer, sizeof(buffer));
+    bool thrown = false;
+    try {
+        for (int i = 0; i < 1000; ++i) {
+            (void)arena.make<Counter>(i);
+        }
+    } catch (const std::bad_alloc &) {
+        thrown = true;
+    }
+    TEST_ASSERT_TRUE(thrown);
+    arena.reset();
+    TEST_ASSERT_NULL(arena.handle()->dtors);
+}
+
+extern "C" void test_arena_allocator_wrapper_free_runs_dtors(void) {
+    Counter::destroyed = 0;
+    {
+        arena_allocator::Arena arena;
+        (void)arena.make<Counter>(1);
+        (void)arena.make<Counter>(2);
+        TEST_ASSERT_EQUAL_INT(0, Counter::destroyed);
+    }
+    TEST_ASSERT_EQUAL_INT(2, Counter::destroyed);
+}
+
+extern "C" void test_arena_allocator_wrapper_rewind_runs_dtors(void) {
+    Counter::destroyed = 0;
+    arena_allocator::Arena arena;
+    const Counter *kept = arena.make<Counter>(1);
+    const ArenaAllocatorMark mark = arena.mark();
+    (void)arena.make<Counter>(2);
+    (void)arena.make<Counter>(3);
+    arena.rewind(mark);
+    TEST_ASSERT_EQUAL_INT(2, Counter::destroyed);
+    TEST_ASSERT_EQUAL_PTR(kept, arena.handle()->dtors->item);
+    TEST_ASSERT_EQUAL_INT(1, kept->value);
+    arena.reset();
+    TEST_ASSERT_EQUAL_INT(3, Counter::destroyed);
+}
+
+extern "C" void test_arena_allocator_wrapper_allocator_equality(void) {
+    arena_allocator::Arena arena;
+    arena_allocator::Arena other;
+    const arena_allocator::Allocator<int> lhs(arena);
+    const arena_allocator::Allocator<int> rhs(arena.handle());
+    const arena_allocator::Allocator<double> converted(lhs);
+    const arena_allocator::Allocator<int> different(other);
+    TEST_ASSERT_TRUE(lhs == rhs);
+    TEST_ASSERT_TRUE(lhs == converted);
+    TEST_ASSERT_FALSE(lhs != converted);
+    TEST_ASSERT_FALSE(lhs == different);
+    TEST_ASSERT_TRUE(lhs != different);
+}
+
+extern "C" void test_arena_allocator_wrapper_allocator_rebind(void) {
+    arena_allocator::Arena arena;
+    using Traits = std::allocator_traits<arena_allocator::Allocator<char>>;
+    Traits::rebind_alloc<double> allocator(arena_allocator::Allocator<char>{ arena });
+    TEST_ASSERT_EQUAL_PTR(arena.handle(), allocator.handle());
+    double *items = allocator.allocate(4U);
+    TEST_ASSERT_NOT_NULL(items);
+    TEST_ASSERT_EQUAL_size_t(0U, reinterpret_cast<std::uintptr_t>(items) % alignof(double));
+    TEST_ASSERT_NOT_EQUAL(0U, arena.handle()->offset);
+    allocator.deallocate(items, 4U);
+}
+
+extern "C" void test_arena_allocator_wrapper_allocate_with_zero_size(void) {
+    arena_allocator::Arena arena;
+    std::pmr::memory_resource *resource = &arena;
+    void *first = resource->allocate(0U);
+    void *second = resource->allocate(0U, alignof(std::max_align_t));
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_NOT_EQUAL(first, second);
+    TEST_ASSERT_EQUAL_size_t(0U, reinterpret_cast<std::uintptr_t>(second) % alignof(std::max_align_t));
+    resource->deallocate(first, 0U);
+    resource->deallocate(second, 0U, alignof(std::max_align_t));
+
+    arena_allocator::Allocator<int> allocator(arena);
+    int *items = allocator.allocate(0U);
+    TEST_ASSERT_NOT_NULL(items);
+    TEST_ASSERT_NOT_EQUAL(second, items);
+}
+
+extern "C" void test_arena_allocator_wrapper_memory_resource_equality(void) {
+    arena_allocator::Arena arena;
+    arena_allocator::Arena other;
+    const std::pmr::memory_resource &resource = arena;
+    TEST_ASSERT_TRUE(resource.is_equal(arena));
+    TEST_ASSERT_FALSE(resource.is_equal(other));
+}
+
+/*! @} */